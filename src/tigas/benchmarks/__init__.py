@@ -0,0 +1,10 @@
+"""Microbenchmark suite with JSON baselines and regression comparison.
+
+Run `python -m tigas.benchmarks` to time the hot loader, rasterizer,
+quantizer, and metric paths, and `--compare baseline.json` to fail when a
+case regresses past a configurable threshold.
+"""
+
+from tigas.benchmarks.harness import BenchmarkCase, compare_baselines, time_case
+
+__all__ = ["BenchmarkCase", "compare_baselines", "time_case"]
@@ -0,0 +1,118 @@
+"""CLI entrypoint for the TIGAS microbenchmark suite.
+
+Baseline workflow:
+
+    python -m tigas.benchmarks --output baseline.json
+    python -m tigas.benchmarks --compare baseline.json --threshold-pct 15
+
+Compare mode exits non-zero when any shared case regresses past the
+threshold, so it can gate CI the same way the contract tests do.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import platform
+import sys
+import tempfile
+from datetime import datetime, timezone
+from pathlib import Path
+
+from tigas.benchmarks.cases import build_default_cases
+from tigas.benchmarks.harness import compare_baselines, time_case
+
+
+def build_parser() -> argparse.ArgumentParser:
+    parser = argparse.ArgumentParser(
+        prog="python -m tigas.benchmarks",
+        description="Run TIGAS microbenchmarks and track regressions against JSON baselines",
+    )
+    parser.add_argument("--repeats", type=int, default=5, help="Timed iterations per case")
+    parser.add_argument("--warmup", type=int, default=1, help="Untimed warmup iterations per case")
+    parser.add_argument(
+        "--points",
+        type=int,
+        default=100_000,
+        help="Point count used for loader and quantizer cases",
+    )
+    parser.add_argument(
+        "--filter",
+        default="",
+        help="Only run cases whose name contains this substring",
+    )
+    parser.add_argument(
+        "--output",
+        default="",
+        help="Write the results JSON to this path instead of stdout only",
+    )
+    parser.add_argument(
+        "--compare",
+        default="",
+        help="Baseline JSON to compare against; regressions fail the run",
+    )
+    parser.add_argument(
+        "--threshold-pct",
+        type=float,
+        default=20.0,
+        help="Median slowdown percentage treated as a regression in compare mode",
+    )
+    return parser
+
+
+def run_suite(args: argparse.Namespace) -> dict:
+    with tempfile.TemporaryDirectory(prefix="tigas-bench-") as scratch:
+        cases = build_default_cases(Path(scratch), point_count=args.points)
+        results: dict[str, dict[str, float]] = {}
+        for case in cases:
+            if args.filter and args.filter not in case.name:
+                continue
+            run = case.setup()
+            results[case.name] = time_case(run, repeats=args.repeats, warmup=args.warmup)
+
+    return {
+        "schema_version": 1,
+        "created_utc": datetime.now(timezone.utc).isoformat(),
+        "repeats": args.repeats,
+        "warmup": args.warmup,
+        "host": {
+            "platform": platform.platform(),
+            "python": platform.python_version(),
+            "cpu_count": os.cpu_count() or 1,
+        },
+        "cases": results,
+    }
+
+
+def main() -> int:
+    args = build_parser().parse_args()
+    report = run_suite(args)
+
+    if args.output:
+        output_path = Path(args.output)
+        output_path.parent.mkdir(parents=True, exist_ok=True)
+        output_path.write_text(json.dumps(report, indent=2) + "\n", encoding="utf-8")
+
+    exit_code = 0
+    if args.compare:
+        baseline = json.loads(Path(args.compare).read_text(encoding="utf-8"))
+        records = compare_baselines(
+            report["cases"],
+            baseline.get("cases", {}),
+            threshold_pct=args.threshold_pct,
+        )
+        report["comparison"] = {
+            "baseline_path": args.compare,
+            "threshold_pct": args.threshold_pct,
+            "records": records,
+        }
+        if any(record["regressed"] for record in records):
+            exit_code = 1
+
+    print(json.dumps(report, indent=2))
+    return exit_code
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,234 @@
+"""Default benchmark cases over synthetic, deterministic assets.
+
+Assets are generated into a scratch directory during case setup so the suite
+has no dependency on checked-in point clouds, and every run measures the same
+bytes regardless of host.
+"""
+
+from __future__ import annotations
+
+import math
+import struct
+from pathlib import Path
+from typing import Callable, List
+
+import numpy as np
+
+from tigas.benchmarks.harness import BenchmarkCase
+from tigas.evaluation.metrics import ssim_proxy
+from tigas.input_control.headless_replayer import HeadlessTraceReplayer
+from tigas.renderer.backend_cpu import CpuFallbackBackend
+from tigas.renderer.supersplat_loader import (
+    load_standard_3dgs_ply,
+    load_supersplat_compressed_ply,
+)
+from tigas.shared.types import RenderRequest
+
+_STANDARD_HEADER_FIELDS = (
+    "x",
+    "y",
+    "z",
+    "f_dc_0",
+    "f_dc_1",
+    "f_dc_2",
+    "opacity",
+    "scale_0",
+    "scale_1",
+    "scale_2",
+)
+
+
+def write_standard_3dgs_ply(path: Path, point_count: int, seed: int = 7) -> Path:
+    """Write a synthetic standard Graphdeco 3DGS PLY with `point_count` points."""
+    header = "\n".join(
+        ["ply", "format binary_little_endian 1.0", f"element vertex {point_count}"]
+        + [f"property float {name}" for name in _STANDARD_HEADER_FIELDS]
+        + ["end_header", ""]
+    ).encode("ascii")
+
+    rng = np.random.default_rng(seed)
+    records = np.empty((point_count, len(_STANDARD_HEADER_FIELDS)), dtype="<f4")
+    records[:, 0:3] = rng.normal(0.0, 0.6, size=(point_count, 3))
+    records[:, 3:6] = rng.normal(0.0, 1.0, size=(point_count, 3))
+    records[:, 6] = rng.normal(1.0, 1.0, size=point_count)
+    records[:, 7:10] = rng.uniform(-6.0, -3.0, size=(point_count, 3))
+
+    path.write_bytes(header + records.tobytes())
+    return path
+
+
+def write_supersplat_compressed_ply(path: Path, point_count: int, seed: int = 7) -> Path:
+    """Write a synthetic SuperSplat compressed PLY with `point_count` points."""
+    chunk_count = max(1, int(math.ceil(point_count / 256.0)))
+    header = "\n".join(
+        [
+            "ply",
+            "format binary_little_endian 1.0",
+            f"element chunk {chunk_count}",
+        ]
+        + [
+            f"property float {prefix}_{axis}"
+            for prefix in ("min", "max")
+            for axis in ("x", "y", "z")
+        ]
+        + [
+            f"property float {prefix}_scale_{axis}"
+            for prefix in ("min", "max")
+            for axis in ("x", "y", "z")
+        ]
+        + [
+            f"property float {prefix}_{channel}"
+            for prefix in ("min", "max")
+            for channel in ("r", "g", "b")
+        ]
+        + [
+            f"element vertex {point_count}",
+            "property uint packed_position",
+            "property uint packed_rotation",
+            "property uint packed_scale",
+            "property uint packed_color",
+            "end_header",
+            "",
+        ]
+    ).encode("ascii")
+
+    chunk = struct.pack(
+        "<18f",
+        # position bounds
+        -2.0, -2.0, -2.0, 2.0, 2.0, 2.0,
+        # log-scale bounds (decoded through exp by the loader heuristic)
+        -6.0, -6.0, -6.0, -1.0, -1.0, -1.0,
+        # SH DC color coefficient bounds
+        -1.0, -1.0, -1.0, 1.0, 1.0, 1.0,
+    )
+
+    rng = np.random.default_rng(seed)
+    q10 = rng.integers(0, 1024, size=(point_count, 3), dtype=np.uint32)
+    q8 = rng.integers(0, 256, size=(point_count, 4), dtype=np.uint32)
+    vertices = np.empty((point_count, 4), dtype="<u4")
+    vertices[:, 0] = q10[:, 0] | (q10[:, 1] << 10) | (q10[:, 2] << 20)
+    vertices[:, 1] = 0
+    vertices[:, 2] = q10[:, 0] | (q10[:, 1] << 10) | (q10[:, 2] << 20)
+    vertices[:, 3] = q8[:, 0] | (q8[:, 1] << 8) | (q8[:, 2] << 16) | (q8[:, 3] << 24)
+
+    path.write_bytes(header + chunk * chunk_count + vertices.tobytes())
+    return path
+
+
+def _loader_case(name: str, writer, loader, workdir: Path, point_count: int) -> BenchmarkCase:
+    def setup() -> Callable[[], object]:
+        ply_path = writer(workdir / f"{name}.ply", point_count)
+
+        def run() -> object:
+            return loader(str(ply_path))
+
+        return run
+
+    return BenchmarkCase(name=name, setup=setup)
+
+
+def _render_case(workdir: Path, point_count: int, width: int, height: int) -> BenchmarkCase:
+    name = f"cpu_render_{point_count // 1000}k_{width}x{height}"
+
+    def setup() -> Callable[[], object]:
+        ply_path = write_standard_3dgs_ply(workdir / f"{name}.ply", point_count)
+        backend = CpuFallbackBackend(
+            point_cloud_path=str(ply_path),
+            width=width,
+            height=height,
+            max_points=point_count,
+            use_scene_cache=False,
+        )
+        backend.initialize()
+        block = HeadlessTraceReplayer().generate_orbit_block(
+            center=backend.scene_center,
+            radius=backend.scene_radius,
+            num_frames=16,
+        )
+        matrices = block.camera_matrices
+        state = {"index": 0}
+
+        def run() -> object:
+            index = state["index"]
+            state["index"] = (index + 1) % matrices.shape[0]
+            frame = backend.render(
+                RenderRequest(
+                    pose_matrix_4x4=matrices[index].tolist(),
+                    lod_id="full",
+                    time_offset_ms=0.0,
+                )
+            )
+            backend.recycle(frame)
+            return frame
+
+        return run
+
+    return BenchmarkCase(name=name, setup=setup)
+
+
+def _quantizer_case(workdir: Path, point_count: int) -> BenchmarkCase:
+    name = f"quantize_lod_buffers_{point_count // 1000}k"
+
+    def setup() -> Callable[[], object]:
+        ply_path = write_standard_3dgs_ply(workdir / f"{name}.ply", point_count)
+        backend = CpuFallbackBackend(
+            point_cloud_path=str(ply_path),
+            max_points=point_count,
+            use_scene_cache=False,
+        )
+        backend.initialize()
+
+        def run() -> object:
+            backend._prepare_quantized_lod_buffers()
+            return None
+
+        return run
+
+    return BenchmarkCase(name=name, setup=setup)
+
+
+def _ssim_case(width: int, height: int) -> BenchmarkCase:
+    name = f"ssim_proxy_{width}x{height}"
+
+    def setup() -> Callable[[], object]:
+        rng = np.random.default_rng(7)
+        reference = rng.integers(0, 256, size=(height, width, 3), dtype=np.uint8)
+        test = np.clip(
+            reference.astype(np.int16) + rng.integers(-8, 9, size=reference.shape),
+            0,
+            255,
+        ).astype(np.uint8)
+
+        def run() -> object:
+            return ssim_proxy(reference, test)
+
+        return run
+
+    return BenchmarkCase(name=name, setup=setup)
+
+
+def build_default_cases(workdir: Path, point_count: int = 100_000) -> List[BenchmarkCase]:
+    """Build the default case list over assets generated under `workdir`."""
+    workdir.mkdir(parents=True, exist_ok=True)
+    points_label = point_count // 1000
+    return [
+        _loader_case(
+            f"load_standard_ply_{points_label}k",
+            write_standard_3dgs_ply,
+            load_standard_3dgs_ply,
+            workdir,
+            point_count,
+        ),
+        _loader_case(
+            f"load_supersplat_ply_{points_label}k",
+            write_supersplat_compressed_ply,
+            load_supersplat_compressed_ply,
+            workdir,
+            point_count,
+        ),
+        _render_case(workdir, point_count=20_000, width=320, height=180),
+        _render_case(workdir, point_count=60_000, width=640, height=360),
+        _render_case(workdir, point_count=point_count, width=960, height=540),
+        _quantizer_case(workdir, point_count),
+        _ssim_case(width=960, height=540),
+    ]
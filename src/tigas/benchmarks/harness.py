@@ -0,0 +1,104 @@
+"""Timing and baseline-comparison helpers for the benchmark suite."""
+
+from __future__ import annotations
+
+import statistics
+import time
+from dataclasses import dataclass
+from typing import Callable, Dict, List
+
+
+@dataclass(slots=True)
+class BenchmarkCase:
+    """One named benchmark: `setup` returns the zero-arg callable to time.
+
+    Setup cost (asset generation, renderer initialization) is excluded from
+    the timed region so results reflect only the hot path under test.
+    """
+
+    name: str
+    setup: Callable[[], Callable[[], object]]
+
+
+def time_case(
+    fn: Callable[[], object],
+    repeats: int = 5,
+    warmup: int = 1,
+) -> Dict[str, float]:
+    """Time `fn` and return a summary in milliseconds.
+
+    Warmup iterations absorb one-time costs (page faults, numpy internals)
+    that would otherwise skew the first sample.
+    """
+    if repeats < 1:
+        raise ValueError("Benchmark repeats must be at least 1.")
+
+    for _ in range(max(0, warmup)):
+        fn()
+
+    samples_ms: List[float] = []
+    for _ in range(repeats):
+        start_ns = time.perf_counter_ns()
+        fn()
+        samples_ms.append((time.perf_counter_ns() - start_ns) / 1e6)
+
+    ordered = sorted(samples_ms)
+    p95_index = min(len(ordered) - 1, int(round(0.95 * (len(ordered) - 1))))
+    return {
+        "repeats": float(repeats),
+        "mean_ms": float(statistics.fmean(samples_ms)),
+        "median_ms": float(statistics.median(samples_ms)),
+        "min_ms": float(ordered[0]),
+        "max_ms": float(ordered[-1]),
+        "p95_ms": float(ordered[p95_index]),
+        "stdev_ms": float(statistics.stdev(samples_ms)) if repeats > 1 else 0.0,
+    }
+
+
+def compare_baselines(
+    current_cases: Dict[str, Dict[str, float]],
+    baseline_cases: Dict[str, Dict[str, float]],
+    threshold_pct: float = 20.0,
+) -> List[Dict[str, object]]:
+    """Compare current medians against a baseline, newest-median vs oldest.
+
+    Returns one record per case present in both runs with the percentage
+    delta; callers treat `regressed=True` entries as failures. Cases present
+    in only one run are reported with `regressed=False` so renamed or new
+    benchmarks never fail a comparison silently.
+    """
+    if threshold_pct < 0.0:
+        raise ValueError("Regression threshold must be non-negative.")
+
+    records: List[Dict[str, object]] = []
+    for name in sorted(set(current_cases) | set(baseline_cases)):
+        current = current_cases.get(name)
+        baseline = baseline_cases.get(name)
+        if current is None or baseline is None:
+            records.append(
+                {
+                    "case": name,
+                    "status": "missing_in_current" if current is None else "missing_in_baseline",
+                    "regressed": False,
+                }
+            )
+            continue
+
+        baseline_median = float(baseline["median_ms"])
+        current_median = float(current["median_ms"])
+        delta_pct = (
+            100.0 * (current_median - baseline_median) / baseline_median
+            if baseline_median > 0.0
+            else 0.0
+        )
+        records.append(
+            {
+                "case": name,
+                "status": "compared",
+                "baseline_median_ms": baseline_median,
+                "current_median_ms": current_median,
+                "delta_pct": delta_pct,
+                "regressed": delta_pct > threshold_pct,
+            }
+        )
+    return records
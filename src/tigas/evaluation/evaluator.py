@@ -8,15 +8,18 @@ from __future__ import annotations
 
 import csv
 import json
+import os
 import shutil
 import subprocess
+from concurrent.futures import ProcessPoolExecutor
 from dataclasses import asdict, dataclass, replace
 from datetime import datetime, timezone
 from pathlib import Path
 
 import numpy as np
 
-from tigas.evaluation.metrics import ssim_proxy
+from tigas.evaluation.metrics import psnr, ssim_proxy, ssim_windowed
+from tigas.evaluation.run_cache import RunCache
 from tigas.orchestration.ablation_runner import HeadlessAblationRunner
 from tigas.shared.types import ExperimentConfig
 
@@ -27,6 +30,109 @@ class EvaluationRunResult:
     frames: list[np.ndarray]
 
 
+class _StreamingVideoEncoder:
+    """Persistent ffmpeg child fed rawvideo frames over stdin.
+
+    Encoding overlaps rendering and no intermediate frame files touch disk;
+    the PPM dump path remains available as an opt-in debug artifact.
+    """
+
+    def __init__(self, output_path: Path, width: int, height: int, fps: int) -> None:
+        ffmpeg = shutil.which("ffmpeg")
+        if ffmpeg is None:
+            raise RuntimeError(
+                "ffmpeg is required by the evaluation component but was not found in PATH."
+            )
+        self.output_path = output_path
+        self.encoder = EvaluationRunner._select_encoder(ffmpeg)
+        self._process = subprocess.Popen(
+            [
+                ffmpeg,
+                "-y",
+                "-hide_banner",
+                "-loglevel",
+                "error",
+                "-f",
+                "rawvideo",
+                "-pix_fmt",
+                "rgb24",
+                "-s",
+                f"{width}x{height}",
+                "-framerate",
+                str(max(1, fps)),
+                "-i",
+                "-",
+                "-c:v",
+                self.encoder,
+                "-pix_fmt",
+                "yuv420p",
+                str(output_path),
+            ],
+            stdin=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+        )
+
+    def write(self, frame_bytes: bytes | memoryview) -> None:
+        assert self._process.stdin is not None
+        self._process.stdin.write(frame_bytes)
+
+    def close(self) -> tuple[Path, str]:
+        """Flush the stream and wait for ffmpeg to finalize the container."""
+        assert self._process.stdin is not None
+        self._process.stdin.close()
+        stderr = b""
+        if self._process.stderr is not None:
+            stderr = self._process.stderr.read()
+        return_code = self._process.wait()
+        if return_code != 0:
+            raise RuntimeError(
+                "ffmpeg streaming encode failed: "
+                f"return_code={return_code}, stderr={stderr.decode(errors='ignore').strip()}"
+            )
+        return self.output_path, self.encoder
+
+    def abort(self) -> None:
+        """Kill the child without finalizing output (run failed upstream)."""
+        if self._process.poll() is None:
+            self._process.kill()
+            self._process.wait()
+
+
+def _sweep_worker_init(affinity_queue) -> None:
+    """Optionally pin each sweep worker process to its own CPU slice."""
+    if affinity_queue is None or not hasattr(os, "sched_setaffinity"):
+        return
+    try:
+        cpus = affinity_queue.get_nowait()
+    except Exception:  # noqa: BLE001 - affinity is best-effort
+        return
+    if cpus:
+        try:
+            os.sched_setaffinity(0, cpus)
+        except OSError:  # pragma: no cover - host-permission dependent
+            pass
+
+
+def _execute_sweep_run(
+    config: ExperimentConfig,
+    output_root: str,
+    reference_frames_path: str | None,
+    quality_metric: str = "proxy",
+) -> dict:
+    """Process-pool entrypoint executing one independent sweep configuration."""
+    reference_frames = None
+    if reference_frames_path:
+        reference_frames = np.load(reference_frames_path, mmap_mode="r")
+    result = EvaluationRunner().run_one(
+        config=config,
+        output_root=output_root,
+        reference_frames=reference_frames,
+        capture_frames=False,
+        quality_metric=quality_metric,
+    )
+    return result.summary
+
+
 class EvaluationRunner:
     """Runs repeatable offline evaluations without polluting runtime paths."""
 
@@ -113,16 +219,40 @@ class EvaluationRunner:
         self,
         config: ExperimentConfig,
         output_root: str,
-        reference_frames: list[np.ndarray] | None = None,
+        reference_frames: list[np.ndarray] | np.ndarray | None = None,
         capture_frames: bool = False,
+        stream_encode: bool = True,
+        dump_ppm_frames: bool = False,
+        quality_metric: str = "proxy",
     ) -> EvaluationRunResult:
-        """Run one evaluation config and write artifacts under output_root."""
+        """Run one evaluation config and write artifacts under output_root.
+
+        Frames stream into a persistent ffmpeg encoder by default; set
+        `stream_encode=False` to fall back to the PPM-file round-trip, and
+        `dump_ppm_frames=True` to keep per-frame PPMs as debug artifacts.
+        `quality_metric` selects the global SSIM proxy or the windowed
+        SSIM/PSNR engine for reference comparisons.
+        """
+        if quality_metric not in {"proxy", "windowed"}:
+            raise ValueError(f"Unsupported quality metric '{quality_metric}'.")
         run_dir = self._build_run_dir(Path(output_root), config)
+        write_ppm_frames = dump_ppm_frames or not stream_encode
         frames_dir = run_dir / "frames"
-        frames_dir.mkdir(parents=True, exist_ok=True)
+        if write_ppm_frames:
+            frames_dir.mkdir(parents=True, exist_ok=True)
+
+        stream_encoder: _StreamingVideoEncoder | None = None
+        if stream_encode:
+            stream_encoder = _StreamingVideoEncoder(
+                output_path=run_dir / "headless_render.mp4",
+                width=config.width,
+                height=config.height,
+                fps=config.fps,
+            )
 
         frame_rows: list[dict] = []
         ssim_values: list[float] = []
+        psnr_values: list[float] = []
         captured_frames: list[np.ndarray] = []
 
         def on_frame(
@@ -133,20 +263,32 @@ class EvaluationRunner:
             datagram,
             render_ms: float,
         ) -> None:
-            frame_rgb = np.frombuffer(frame_bytes, dtype=np.uint8).reshape((height, width, 3)).copy()
-            self._write_ppm(frames_dir / f"frame_{frame_id:05d}.ppm", frame_rgb)
+            # Borrow the pooled frame buffer; only the capture path copies.
+            frame_rgb = np.frombuffer(frame_bytes, dtype=np.uint8).reshape((height, width, 3))
+            if stream_encoder is not None:
+                stream_encoder.write(frame_bytes)
+            if write_ppm_frames:
+                self._write_ppm(frames_dir / f"frame_{frame_id:05d}.ppm", frame_rgb)
 
             active_pixels = np.count_nonzero(frame_rgb.sum(axis=2))
             coverage = float(active_pixels / (width * height))
             brightness = float(frame_rgb.mean() / 255.0)
 
+            psnr_value = float("nan")
             if reference_frames is not None and frame_id < len(reference_frames):
-                ssim = ssim_proxy(reference_frames[frame_id], frame_rgb)
+                reference = np.asarray(reference_frames[frame_id])
+                if quality_metric == "windowed":
+                    ssim = ssim_windowed(reference, frame_rgb)
+                    psnr_value = psnr(reference, frame_rgb)
+                else:
+                    ssim = ssim_proxy(reference, frame_rgb)
             else:
                 ssim = float("nan")
 
             if not np.isnan(ssim):
                 ssim_values.append(ssim)
+            if not np.isnan(psnr_value):
+                psnr_values.append(psnr_value)
 
             frame_rows.append(
                 {
@@ -156,13 +298,28 @@ class EvaluationRunner:
                     "coverage": coverage,
                     "brightness": brightness,
                     "ssim_vs_full": ssim,
+                    "psnr_vs_full": psnr_value,
                 }
             )
 
             if capture_frames:
-                captured_frames.append(frame_rgb)
-
-        runtime_summary = self.runtime_runner.run_one(config, frame_callback=on_frame)
+                captured_frames.append(frame_rgb.copy())
+
+        try:
+            runtime_summary = self.runtime_runner.run_one(config, frame_callback=on_frame)
+        except BaseException:
+            if stream_encoder is not None:
+                stream_encoder.abort()
+            raise
+
+        if stream_encoder is not None:
+            video_path, encoder_used = stream_encoder.close()
+        else:
+            video_path, encoder_used = self._encode_video(
+                frames_dir=frames_dir,
+                output_path=run_dir / "headless_render.mp4",
+                fps=config.fps,
+            )
 
         metrics_csv = run_dir / "frame_metrics.csv"
         with metrics_csv.open("w", encoding="utf-8", newline="") as handle:
@@ -175,28 +332,25 @@ class EvaluationRunner:
                     "coverage",
                     "brightness",
                     "ssim_vs_full",
+                    "psnr_vs_full",
                 ],
             )
             writer.writeheader()
             writer.writerows(frame_rows)
 
-        video_path, encoder_used = self._encode_video(
-            frames_dir=frames_dir,
-            output_path=run_dir / "headless_render.mp4",
-            fps=config.fps,
-        )
-
         coverage_values = [float(row["coverage"]) for row in frame_rows]
         brightness_values = [float(row["brightness"]) for row in frame_rows]
 
         summary = {
             **runtime_summary,
             "output_dir": str(run_dir),
-            "frames_dir": str(frames_dir),
+            "frames_dir": str(frames_dir) if write_ppm_frames else None,
             "frame_metrics_csv": str(metrics_csv),
             "coverage_mean": float(np.mean(coverage_values)) if coverage_values else 0.0,
             "brightness_mean": float(np.mean(brightness_values)) if brightness_values else 0.0,
             "ssim_vs_full_mean": float(np.mean(ssim_values)) if ssim_values else None,
+            "psnr_vs_full_mean": float(np.mean(psnr_values)) if psnr_values else None,
+            "quality_metric": quality_metric,
             "video_path": str(video_path),
             "video_encoder": encoder_used,
         }
@@ -208,6 +362,48 @@ class EvaluationRunner:
 
         return EvaluationRunResult(summary=summary, frames=captured_frames)
 
+    @staticmethod
+    def _curve_row(
+        summary: dict,
+        resolution_text: str,
+        sparsity: float,
+        ssim_override: float | None = None,
+    ) -> dict:
+        return {
+            "resolution": resolution_text,
+            "abr_profile": summary.get("abr_profile"),
+            "lod": summary["config"]["default_lod"],
+            "sparsity": sparsity,
+            "quant_bits": summary["config"]["quant_bits"],
+            "point_count": summary["point_count"],
+            "render_ms_mean": summary["render_time_ms"]["mean"],
+            "render_ms_p95": summary["render_time_ms"]["p95"],
+            "coverage_mean": summary["coverage_mean"],
+            "brightness_mean": summary["brightness_mean"],
+            "ssim_vs_full_mean": ssim_override
+            if ssim_override is not None
+            else summary["ssim_vs_full_mean"],
+            "effective_fps": summary["effective_fps"],
+            "summary_path": summary["summary_path"],
+            "video_path": summary["video_path"],
+        }
+
+    @staticmethod
+    def _build_affinity_queue(worker_count: int, cpus_per_worker: int | None):
+        """Distribute host CPUs into per-worker affinity sets."""
+        if not cpus_per_worker or not hasattr(os, "sched_getaffinity"):
+            return None
+
+        import multiprocessing
+
+        cpus = sorted(os.sched_getaffinity(0))
+        affinity_queue = multiprocessing.Queue()
+        for worker_idx in range(worker_count):
+            start = (worker_idx * cpus_per_worker) % max(1, len(cpus))
+            slice_cpus = [cpus[(start + offset) % len(cpus)] for offset in range(cpus_per_worker)]
+            affinity_queue.put(set(slice_cpus))
+        return affinity_queue
+
     def run_tradeoff_curve(
         self,
         base_config: ExperimentConfig,
@@ -215,14 +411,32 @@ class EvaluationRunner:
         sparsity_levels: list[float],
         resolutions: list[tuple[int, int]],
         quant_bits_list: list[int],
+        max_workers: int | None = None,
+        cpus_per_worker: int | None = None,
+        quality_metric: str = "proxy",
+        incremental: bool = False,
+        force: bool = False,
     ) -> dict:
-        """Sweep sparsity/resolution/quantization and save a tradeoff curve."""
+        """Sweep sparsity/resolution/quantization and save a tradeoff curve.
+
+        Baseline reference runs execute first (dependent runs compare against
+        them); with `max_workers` greater than one the remaining independent
+        configurations fan out across a process pool. With `incremental` a
+        content-hash run cache under the output root skips configurations
+        whose inputs (config fields, PLY and trace contents, code version)
+        are unchanged since a previous sweep; `force` discards the cache
+        index and recomputes everything.
+        """
         root = Path(output_root)
         root.mkdir(parents=True, exist_ok=True)
 
+        run_cache = RunCache(output_root, force=force) if incremental else None
+        parallel = max_workers is not None and max_workers > 1
         curve_rows: list[dict] = []
+        pending_jobs: list[tuple[ExperimentConfig, str | None, str, float, str | None]] = []
 
         for width, height in resolutions:
+            resolution_text = f"{width}x{height}"
             baseline_config = replace(
                 base_config,
                 width=width,
@@ -231,31 +445,40 @@ class EvaluationRunner:
                 quant_bits=max(quant_bits_list) if quant_bits_list else 8,
                 max_points=max(1, int(base_config.max_points)),
             )
-            baseline_result = self.run_one(
-                config=baseline_config,
-                output_root=output_root,
-                reference_frames=None,
-                capture_frames=True,
-            )
-            baseline_frames = baseline_result.frames
-            baseline_summary = baseline_result.summary
+            # A cached baseline is only reusable when its captured frames
+            # survived on disk: dependent runs compare against them.
+            baseline_key = run_cache.key_for(baseline_config) if run_cache is not None else None
+            baseline_summary: dict | None = None
+            baseline_frames: list[np.ndarray] | np.ndarray = []
+            reference_path: str | None = None
+            if baseline_key is not None:
+                cached_baseline = run_cache.lookup(baseline_key)
+                if cached_baseline is not None:
+                    cached_reference = Path(cached_baseline["output_dir"]) / "reference_frames.npy"
+                    if cached_reference.is_file():
+                        baseline_summary = cached_baseline
+                        reference_path = str(cached_reference)
+                        baseline_frames = np.load(reference_path, mmap_mode="r")
+
+            if baseline_summary is None:
+                baseline_result = self.run_one(
+                    config=baseline_config,
+                    output_root=output_root,
+                    reference_frames=None,
+                    capture_frames=True,
+                )
+                baseline_frames = baseline_result.frames
+                baseline_summary = baseline_result.summary
+                if (parallel or run_cache is not None) and len(baseline_frames):
+                    reference_path = str(
+                        Path(baseline_summary["output_dir"]) / "reference_frames.npy"
+                    )
+                    np.save(reference_path, np.stack(baseline_frames))
+                if baseline_key is not None:
+                    run_cache.store(baseline_key, baseline_summary)
+
             curve_rows.append(
-                {
-                    "resolution": f"{width}x{height}",
-                    "abr_profile": baseline_summary.get("abr_profile"),
-                    "lod": baseline_summary["config"]["default_lod"],
-                    "sparsity": 1.0,
-                    "quant_bits": baseline_summary["config"]["quant_bits"],
-                    "point_count": baseline_summary["point_count"],
-                    "render_ms_mean": baseline_summary["render_time_ms"]["mean"],
-                    "render_ms_p95": baseline_summary["render_time_ms"]["p95"],
-                    "coverage_mean": baseline_summary["coverage_mean"],
-                    "brightness_mean": baseline_summary["brightness_mean"],
-                    "ssim_vs_full_mean": 1.0,
-                    "effective_fps": baseline_summary["effective_fps"],
-                    "summary_path": baseline_summary["summary_path"],
-                    "video_path": baseline_summary["video_path"],
-                }
+                self._curve_row(baseline_summary, resolution_text, 1.0, ssim_override=1.0)
             )
 
             for sparsity in sparsity_levels:
@@ -270,31 +493,59 @@ class EvaluationRunner:
                         max_points=point_budget,
                         quant_bits=int(max(2, min(16, quant_bits))),
                     )
+                    eval_key = (
+                        run_cache.key_for(eval_config, quality_metric, with_reference=True)
+                        if run_cache is not None
+                        else None
+                    )
+                    if eval_key is not None:
+                        cached_summary = run_cache.lookup(eval_key)
+                        if cached_summary is not None:
+                            curve_rows.append(
+                                self._curve_row(cached_summary, resolution_text, safe_sparsity)
+                            )
+                            continue
+
+                    if parallel:
+                        pending_jobs.append(
+                            (eval_config, reference_path, resolution_text, safe_sparsity, eval_key)
+                        )
+                        continue
+
                     result = self.run_one(
                         config=eval_config,
                         output_root=output_root,
                         reference_frames=baseline_frames,
                         capture_frames=False,
+                        quality_metric=quality_metric,
                     )
-                    summary = result.summary
+                    if eval_key is not None:
+                        run_cache.store(eval_key, result.summary)
                     curve_rows.append(
-                        {
-                            "resolution": f"{width}x{height}",
-                            "abr_profile": summary.get("abr_profile"),
-                            "lod": summary["config"]["default_lod"],
-                            "sparsity": safe_sparsity,
-                            "quant_bits": summary["config"]["quant_bits"],
-                            "point_count": summary["point_count"],
-                            "render_ms_mean": summary["render_time_ms"]["mean"],
-                            "render_ms_p95": summary["render_time_ms"]["p95"],
-                            "coverage_mean": summary["coverage_mean"],
-                            "brightness_mean": summary["brightness_mean"],
-                            "ssim_vs_full_mean": summary["ssim_vs_full_mean"],
-                            "effective_fps": summary["effective_fps"],
-                            "summary_path": summary["summary_path"],
-                            "video_path": summary["video_path"],
-                        }
+                        self._curve_row(result.summary, resolution_text, safe_sparsity)
+                    )
+
+        if pending_jobs:
+            worker_count = int(max_workers or 1)
+            affinity_queue = self._build_affinity_queue(worker_count, cpus_per_worker)
+            with ProcessPoolExecutor(
+                max_workers=worker_count,
+                initializer=_sweep_worker_init,
+                initargs=(affinity_queue,),
+            ) as pool:
+                futures = [
+                    pool.submit(
+                        _execute_sweep_run, job_config, output_root, job_reference, quality_metric
                     )
+                    for job_config, job_reference, _, _, _ in pending_jobs
+                ]
+                for (_, _, resolution_text, safe_sparsity, eval_key), future in zip(
+                    pending_jobs, futures
+                ):
+                    summary = future.result()
+                    if run_cache is not None and eval_key is not None:
+                        run_cache.store(eval_key, summary)
+                    curve_rows.append(self._curve_row(summary, resolution_text, safe_sparsity))
 
         curve_csv = root / "tradeoff_curve.csv"
         with curve_csv.open("w", encoding="utf-8", newline="") as handle:
@@ -340,6 +591,7 @@ class EvaluationRunner:
             "curve_csv": str(curve_csv),
             "curve_md": str(curve_md),
             "num_runs": len(curve_rows),
+            "run_cache": run_cache.stats() if run_cache is not None else None,
             "created_at_utc": datetime.now(timezone.utc).isoformat(),
             "base_config": asdict(base_config),
         }
@@ -37,3 +37,71 @@ def ssim_proxy(reference_rgb: np.ndarray, test_rgb: np.ndarray) -> float:
         return 1.0
     value = numerator / denominator
     return float(np.clip(value, -1.0, 1.0))
+
+
+def _window_sums(values: np.ndarray, window: int) -> np.ndarray:
+    """Sliding-window sums over a 2D array via an integral image.
+
+    Returns one sum per fully contained window, shape
+    (height - window + 1, width - window + 1).
+    """
+    height, width = values.shape
+    padded = np.zeros((height + 1, width + 1), dtype=np.float64)
+    np.cumsum(values, axis=0, out=padded[1:, 1:])
+    np.cumsum(padded[1:, 1:], axis=1, out=padded[1:, 1:])
+    return (
+        padded[window:, window:]
+        - padded[:-window, window:]
+        - padded[window:, :-window]
+        + padded[:-window, :-window]
+    )
+
+
+def ssim_windowed(reference_rgb: np.ndarray, test_rgb: np.ndarray, window: int = 8) -> float:
+    """Compute windowed SSIM on luma using integral-image window statistics.
+
+    Unlike `ssim_proxy` this evaluates the SSIM map over local windows, so
+    spatially concentrated artifacts are reflected in the score. The integral
+    image keeps it fully vectorized and a few milliseconds per 1080p frame.
+    """
+    if reference_rgb.shape != test_rgb.shape:
+        raise ValueError("Windowed SSIM requires equal image shapes.")
+
+    x = rgb_to_luma(reference_rgb).astype(np.float64)
+    y = rgb_to_luma(test_rgb).astype(np.float64)
+
+    safe_window = int(max(2, min(window, x.shape[0], x.shape[1])))
+    n = float(safe_window * safe_window)
+
+    sum_x = _window_sums(x, safe_window)
+    sum_y = _window_sums(y, safe_window)
+    sum_x2 = _window_sums(x * x, safe_window)
+    sum_y2 = _window_sums(y * y, safe_window)
+    sum_xy = _window_sums(x * y, safe_window)
+
+    mu_x = sum_x / n
+    mu_y = sum_y / n
+    sigma_x2 = np.maximum(sum_x2 / n - mu_x * mu_x, 0.0)
+    sigma_y2 = np.maximum(sum_y2 / n - mu_y * mu_y, 0.0)
+    sigma_xy = sum_xy / n - mu_x * mu_y
+
+    c1 = 0.01 * 0.01
+    c2 = 0.03 * 0.03
+    numerator = (2.0 * mu_x * mu_y + c1) * (2.0 * sigma_xy + c2)
+    denominator = (mu_x * mu_x + mu_y * mu_y + c1) * (sigma_x2 + sigma_y2 + c2)
+
+    ssim_map = numerator / np.maximum(denominator, 1e-12)
+    return float(np.clip(np.mean(ssim_map), -1.0, 1.0))
+
+
+def psnr(reference_rgb: np.ndarray, test_rgb: np.ndarray) -> float:
+    """Compute PSNR in dB over RGB, capped at 100 dB for identical frames."""
+    if reference_rgb.shape != test_rgb.shape:
+        raise ValueError("PSNR requires equal image shapes.")
+
+    reference = reference_rgb.astype(np.float32) / 255.0
+    test = test_rgb.astype(np.float32) / 255.0
+    mse = float(np.mean((reference - test) ** 2))
+    if mse <= 1e-12:
+        return 100.0
+    return float(min(100.0, 10.0 * np.log10(1.0 / mse)))
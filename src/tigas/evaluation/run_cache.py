@@ -0,0 +1,151 @@
+"""Content-hash run cache for incremental evaluation sweeps.
+
+Between sweeps we typically change one experiment axis while the asset,
+traces, and remaining configs are untouched, yet `run_tradeoff_curve`
+re-renders the full matrix every invocation. The cache keys each run by a
+digest of the `ExperimentConfig` fields, the PLY and trace file contents,
+and the code version, persists summaries in a JSON index under the output
+root, and lets later sweeps skip-and-reuse any run whose inputs are
+byte-identical. `force=True` discards the index and recomputes everything.
+"""
+
+from __future__ import annotations
+
+import hashlib
+import json
+import subprocess
+from dataclasses import asdict
+from datetime import datetime, timezone
+from pathlib import Path
+
+from tigas.shared.types import ExperimentConfig
+
+_INDEX_FILENAME = "run_cache_index.json"
+_SCHEMA_VERSION = 1
+
+_code_version_cache: str | None = None
+
+
+def _digest_file(path: Path) -> str:
+    """Streaming SHA-256 of a file's contents."""
+    digest = hashlib.sha256()
+    with path.open("rb") as handle:
+        for chunk in iter(lambda: handle.read(1 << 20), b""):
+            digest.update(chunk)
+    return digest.hexdigest()
+
+
+def _digest_input(value: str) -> str:
+    """Digest a config input that may be a file path or a bundled-asset name.
+
+    Trace and profile fields accept either real paths or names resolved from
+    the bundled directories; names are stable identifiers, so hashing the
+    literal is enough, while real files are hashed by content so edits to a
+    trace invalidate runs that consumed it.
+    """
+    if not value:
+        return "empty"
+    path = Path(value)
+    if path.is_file():
+        return _digest_file(path)
+    return f"name:{value}"
+
+
+def code_version() -> str:
+    """Best-effort code identity: git HEAD of the installed tree."""
+    global _code_version_cache
+    if _code_version_cache is not None:
+        return _code_version_cache
+    repo_root = Path(__file__).resolve().parents[3]
+    try:
+        completed = subprocess.run(
+            ["git", "-C", str(repo_root), "rev-parse", "HEAD"],
+            capture_output=True,
+            text=True,
+            check=False,
+            timeout=5.0,
+        )
+        version = completed.stdout.strip() if completed.returncode == 0 else "unknown"
+    except (OSError, subprocess.TimeoutExpired):
+        version = "unknown"
+    _code_version_cache = version
+    return version
+
+
+class RunCache:
+    """JSON-index cache of run summaries keyed by input content hashes.
+
+    The index is read once at construction and rewritten on every store;
+    sweeps run for minutes per entry, so write amortization is irrelevant
+    and a crash never loses more than the in-flight run. The cache is
+    single-writer: with a process-pool sweep, lookups and stores happen in
+    the coordinating process, not in the workers.
+    """
+
+    def __init__(self, output_root: str, force: bool = False) -> None:
+        self.index_path = Path(output_root) / _INDEX_FILENAME
+        self.hits = 0
+        self.misses = 0
+        self._entries: dict[str, dict] = {}
+        if not force and self.index_path.is_file():
+            with self.index_path.open("r", encoding="utf-8") as handle:
+                index = json.load(handle)
+            if index.get("schema_version") == _SCHEMA_VERSION:
+                self._entries = index.get("entries", {})
+
+    def key_for(
+        self,
+        config: ExperimentConfig,
+        quality_metric: str = "proxy",
+        with_reference: bool = False,
+    ) -> str:
+        """Content hash of everything that determines a run's summary."""
+        material = {
+            "config": asdict(config),
+            "asset_digest": _digest_input(config.asset_path),
+            "trace_digest": _digest_input(config.trace_path),
+            "network_trace_digest": _digest_input(config.network_trace_path),
+            "abr_profile_digest": _digest_input(config.abr_profile_path),
+            "code_version": code_version(),
+            "quality_metric": quality_metric,
+            "with_reference": with_reference,
+        }
+        encoded = json.dumps(material, sort_keys=True).encode("utf-8")
+        return hashlib.sha256(encoded).hexdigest()
+
+    def lookup(self, key: str) -> dict | None:
+        """Return the cached summary for `key`, or None.
+
+        An entry whose artifacts were cleaned from disk is treated as a
+        miss so reports never point at paths that no longer exist.
+        """
+        entry = self._entries.get(key)
+        if entry is None:
+            self.misses += 1
+            return None
+        summary = entry["summary"]
+        summary_path = summary.get("summary_path")
+        if not summary_path or not Path(summary_path).is_file():
+            self.misses += 1
+            return None
+        self.hits += 1
+        return summary
+
+    def store(self, key: str, summary: dict) -> None:
+        self._entries[key] = {
+            "created_at_utc": datetime.now(timezone.utc).isoformat(),
+            "summary": summary,
+        }
+        self._write_index()
+
+    def _write_index(self) -> None:
+        self.index_path.parent.mkdir(parents=True, exist_ok=True)
+        index = {
+            "schema_version": _SCHEMA_VERSION,
+            "entries": self._entries,
+        }
+        with self.index_path.open("w", encoding="utf-8") as handle:
+            json.dump(index, handle, indent=2)
+
+    def stats(self) -> dict:
+        return {"hits": self.hits, "misses": self.misses, "entries": len(self._entries)}
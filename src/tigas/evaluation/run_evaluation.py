@@ -81,6 +81,34 @@ def build_parser() -> argparse.ArgumentParser:
         default="8,6,4,3",
         help="Comma-separated quantization bits for quantized runs",
     )
+    parser.add_argument(
+        "--quality-metric",
+        default="proxy",
+        choices=["proxy", "windowed"],
+        help="Quality metric engine for reference comparisons",
+    )
+    parser.add_argument(
+        "--sweep-workers",
+        type=int,
+        default=1,
+        help="Process-pool size for independent sweep runs (1 = serial)",
+    )
+    parser.add_argument(
+        "--cpus-per-worker",
+        type=int,
+        default=0,
+        help="Optional CPU affinity slice size per sweep worker (0 = unpinned)",
+    )
+    parser.add_argument(
+        "--incremental",
+        action="store_true",
+        help="Reuse cached summaries for runs whose config, asset, traces, and code are unchanged",
+    )
+    parser.add_argument(
+        "--force",
+        action="store_true",
+        help="Discard the incremental run-cache index and recompute every configuration",
+    )
     return parser
 
 
@@ -116,6 +144,11 @@ def main() -> None:
         sparsity_levels=sparsity_levels,
         resolutions=resolutions,
         quant_bits_list=quant_bits_list,
+        max_workers=args.sweep_workers,
+        cpus_per_worker=args.cpus_per_worker or None,
+        quality_metric=args.quality_metric,
+        incremental=bool(args.incremental),
+        force=bool(args.force),
     )
     print(json.dumps(report, indent=2))
 
@@ -2,6 +2,11 @@
 
 This module replays trace samples as if they were live browser updates, making
 ablation experiments deterministic and reproducible.
+
+Traces are held as a structure-of-arrays `TraceBlock` (timestamps, camera
+matrices and bitrates as NumPy blocks) so million-sample captures load in
+well under a second; per-sample `TraceSample`/`UplinkDatagram` objects are
+materialized only for the samples that actually get replayed.
 """
 
 from __future__ import annotations
@@ -11,6 +16,8 @@ import json
 import math
 from dataclasses import dataclass
 
+import numpy as np
+
 from tigas.shared.types import UplinkDatagram
 
 
@@ -24,118 +31,176 @@ class TraceSample:
     target_bitrate_kbps: int
 
 
+@dataclass(slots=True)
+class TraceBlock:
+    """Structure-of-arrays movement trace for vectorized processing.
+
+    All arrays share the sample axis: `timestamps_ms` is (N,),
+    `camera_matrices` is (N, 16) row-major camera-to-world matrices,
+    `requested_lods` is (N,) unicode and `target_bitrates_kbps` is (N,) int.
+    """
+
+    timestamps_ms: np.ndarray
+    camera_matrices: np.ndarray
+    requested_lods: np.ndarray
+    target_bitrates_kbps: np.ndarray
+
+    def __len__(self) -> int:
+        return int(self.timestamps_ms.shape[0])
+
+    def truncate(self, max_samples: int) -> "TraceBlock":
+        """Return a view limited to the first `max_samples` samples."""
+        if max_samples <= 0 or len(self) <= max_samples:
+            return self
+        return TraceBlock(
+            timestamps_ms=self.timestamps_ms[:max_samples],
+            camera_matrices=self.camera_matrices[:max_samples],
+            requested_lods=self.requested_lods[:max_samples],
+            target_bitrates_kbps=self.target_bitrates_kbps[:max_samples],
+        )
+
+    def to_samples(self) -> list[TraceSample]:
+        """Materialize per-sample objects; call only after truncation."""
+        matrices = self.camera_matrices.tolist()
+        timestamps = self.timestamps_ms.tolist()
+        lods = self.requested_lods.tolist()
+        bitrates = self.target_bitrates_kbps.tolist()
+        return [
+            TraceSample(
+                timestamp_ms=timestamps[idx],
+                camera_matrix_4x4=matrices[idx],
+                requested_lod=lods[idx],
+                target_bitrate_kbps=int(bitrates[idx]),
+            )
+            for idx in range(len(timestamps))
+        ]
+
+
 class HeadlessTraceReplayer:
     """Load and replay trace data while preserving temporal ordering."""
 
     @staticmethod
-    def _normalize(vector: tuple[float, float, float]) -> tuple[float, float, float]:
-        length = math.sqrt(vector[0] ** 2 + vector[1] ** 2 + vector[2] ** 2)
-        if length < 1e-8:
-            return (0.0, 0.0, 0.0)
-        return (vector[0] / length, vector[1] / length, vector[2] / length)
+    def _look_at_batch(eyes: np.ndarray, target: np.ndarray) -> np.ndarray:
+        """Build camera-to-world matrices for all eyes at once.
 
-    @staticmethod
-    def _cross(
-        a: tuple[float, float, float],
-        b: tuple[float, float, float],
-    ) -> tuple[float, float, float]:
-        return (
-            a[1] * b[2] - a[2] * b[1],
-            a[2] * b[0] - a[0] * b[2],
-            a[0] * b[1] - a[1] * b[0],
-        )
+        Vectorized equivalent of the classic look-at construction with a
+        stable up-vector strategy: rows whose forward direction is parallel
+        to world-up fall back to a z-up basis.
+        """
+        eyes = np.asarray(eyes, dtype=np.float64).reshape((-1, 3))
+        target = np.asarray(target, dtype=np.float64).reshape((3,))
+        count = eyes.shape[0]
+
+        forward = target[None, :] - eyes
+        forward_len = np.linalg.norm(forward, axis=1, keepdims=True)
+        forward = np.where(forward_len < 1e-8, 0.0, forward / np.maximum(forward_len, 1e-8))
+
+        right = np.cross(forward, np.array([0.0, 1.0, 0.0]))
+        degenerate = np.linalg.norm(right, axis=1) < 1e-8
+        if np.any(degenerate):
+            right[degenerate] = np.cross(forward[degenerate], np.array([0.0, 0.0, 1.0]))
+        right_len = np.linalg.norm(right, axis=1, keepdims=True)
+        right = np.where(right_len < 1e-8, 0.0, right / np.maximum(right_len, 1e-8))
+
+        up = np.cross(right, forward)
+        up_len = np.linalg.norm(up, axis=1, keepdims=True)
+        up = np.where(up_len < 1e-8, 0.0, up / np.maximum(up_len, 1e-8))
+
+        matrices = np.zeros((count, 16), dtype=np.float64)
+        matrices[:, 0:3] = np.stack([right[:, 0], up[:, 0], -forward[:, 0]], axis=1)
+        matrices[:, 3] = eyes[:, 0]
+        matrices[:, 4:7] = np.stack([right[:, 1], up[:, 1], -forward[:, 1]], axis=1)
+        matrices[:, 7] = eyes[:, 1]
+        matrices[:, 8:11] = np.stack([right[:, 2], up[:, 2], -forward[:, 2]], axis=1)
+        matrices[:, 11] = eyes[:, 2]
+        matrices[:, 15] = 1.0
+        return matrices
 
     def _look_at_camera_to_world(
         self,
         eye: tuple[float, float, float],
         target: tuple[float, float, float],
     ) -> list[float]:
-        """Build a camera-to-world matrix with a stable up-vector strategy."""
-        forward = self._normalize(
-            (target[0] - eye[0], target[1] - eye[1], target[2] - eye[2])
-        )
-
-        world_up = (0.0, 1.0, 0.0)
-        right = self._normalize(self._cross(forward, world_up))
-        if right == (0.0, 0.0, 0.0):
-            world_up = (0.0, 0.0, 1.0)
-            right = self._normalize(self._cross(forward, world_up))
-
-        up = self._normalize(self._cross(right, forward))
-        camera_forward = (-forward[0], -forward[1], -forward[2])
-
-        return [
-            right[0],
-            up[0],
-            camera_forward[0],
-            eye[0],
-            right[1],
-            up[1],
-            camera_forward[1],
-            eye[1],
-            right[2],
-            up[2],
-            camera_forward[2],
-            eye[2],
-            0.0,
-            0.0,
-            0.0,
-            1.0,
-        ]
+        """Build a single camera-to-world matrix (batched path, one row)."""
+        return self._look_at_batch(np.asarray([eye]), np.asarray(target))[0].tolist()
 
-    def load_trace(self, trace_path: str) -> list[TraceSample]:
-        """Parse a movement trace JSON file into typed samples."""
+    def load_trace_block(self, trace_path: str) -> TraceBlock:
+        """Parse a movement trace JSON file into a structure-of-arrays block."""
         with open(trace_path, "r", encoding="utf-8") as handle:
             data = json.load(handle)
 
         if isinstance(data, list):
-            return self._load_position_trace(data)
+            return self._load_position_trace_block(data)
 
-        samples: list[TraceSample] = []
-        for item in data.get("samples", []):
-            samples.append(
-                TraceSample(
-                    timestamp_ms=float(item["timestamp_ms"]),
-                    camera_matrix_4x4=list(item["camera_matrix_4x4"]),
-                    requested_lod=str(item.get("requested_lod", "full")),
-                    target_bitrate_kbps=int(item.get("target_bitrate_kbps", 4000)),
-                )
-            )
-        return samples
+        rows = data.get("samples", [])
+        count = len(rows)
+        timestamps = np.fromiter(
+            (float(item["timestamp_ms"]) for item in rows), dtype=np.float64, count=count
+        )
+        matrices = np.asarray(
+            [item["camera_matrix_4x4"] for item in rows], dtype=np.float64
+        ).reshape((count, 16))
+        lods = np.asarray([str(item.get("requested_lod", "full")) for item in rows])
+        bitrates = np.fromiter(
+            (int(item.get("target_bitrate_kbps", 4000)) for item in rows),
+            dtype=np.int64,
+            count=count,
+        )
+        return TraceBlock(
+            timestamps_ms=timestamps,
+            camera_matrices=matrices,
+            requested_lods=lods,
+            target_bitrates_kbps=bitrates,
+        )
 
-    def _load_position_trace(self, rows: list[dict]) -> list[TraceSample]:
+    def load_trace(self, trace_path: str) -> list[TraceSample]:
+        """Parse a movement trace JSON file into typed samples."""
+        return self.load_trace_block(trace_path).to_samples()
+
+    def _load_position_trace_block(self, rows: list[dict]) -> TraceBlock:
         """Parse movement traces with x/y/z/tMs structure into camera matrices."""
-        if not rows:
-            return []
-
-        points = [
-            (
-                float(item.get("x", 0.0)),
-                float(item.get("y", 0.0)),
-                float(item.get("z", 0.0)),
+        count = len(rows)
+        if count == 0:
+            return TraceBlock(
+                timestamps_ms=np.zeros((0,), dtype=np.float64),
+                camera_matrices=np.zeros((0, 16), dtype=np.float64),
+                requested_lods=np.zeros((0,), dtype="<U16"),
+                target_bitrates_kbps=np.zeros((0,), dtype=np.int64),
             )
-            for item in rows
-        ]
-        center = (
-            sum(p[0] for p in points) / len(points),
-            sum(p[1] for p in points) / len(points),
-            sum(p[2] for p in points) / len(points),
-        )
 
-        samples: list[TraceSample] = []
-        for idx, item in enumerate(rows):
-            eye = points[idx]
-            matrix = self._look_at_camera_to_world(eye=eye, target=center)
-            timestamp = float(item.get("tMs", idx * 33.333))
-            samples.append(
-                TraceSample(
-                    timestamp_ms=timestamp,
-                    camera_matrix_4x4=matrix,
-                    requested_lod=str(item.get("requested_lod", "full")),
-                    target_bitrate_kbps=int(item.get("target_bitrate_kbps", 4000)),
+        eyes = np.asarray(
+            [
+                (
+                    float(item.get("x", 0.0)),
+                    float(item.get("y", 0.0)),
+                    float(item.get("z", 0.0)),
                 )
-            )
-        return samples
+                for item in rows
+            ],
+            dtype=np.float64,
+        )
+        center = eyes.mean(axis=0)
+        matrices = self._look_at_batch(eyes, center)
+
+        default_timestamps = np.arange(count, dtype=np.float64) * 33.333
+        timestamps = np.fromiter(
+            (float(item["tMs"]) if "tMs" in item else default_timestamps[idx]
+             for idx, item in enumerate(rows)),
+            dtype=np.float64,
+            count=count,
+        )
+        lods = np.asarray([str(item.get("requested_lod", "full")) for item in rows])
+        bitrates = np.fromiter(
+            (int(item.get("target_bitrate_kbps", 4000)) for item in rows),
+            dtype=np.int64,
+            count=count,
+        )
+        return TraceBlock(
+            timestamps_ms=timestamps,
+            camera_matrices=matrices,
+            requested_lods=lods,
+            target_bitrates_kbps=bitrates,
+        )
 
     def load_network_trace(self, trace_path: str) -> list[int]:
         """Load a network trace CSV (or newline-separated values) as kbps samples."""
@@ -155,6 +220,24 @@ class HeadlessTraceReplayer:
                 bandwidth_kbps.append(max(1, value))
         return bandwidth_kbps
 
+    def apply_network_trace_block(
+        self,
+        block: TraceBlock,
+        bandwidth_kbps: list[int],
+    ) -> TraceBlock:
+        """Apply network trace values to the block's target-bitrate array."""
+        if len(block) == 0 or not bandwidth_kbps:
+            return block
+
+        bandwidth = np.asarray(bandwidth_kbps, dtype=np.int64)
+        indices = np.arange(len(block), dtype=np.int64) % bandwidth.shape[0]
+        return TraceBlock(
+            timestamps_ms=block.timestamps_ms,
+            camera_matrices=block.camera_matrices,
+            requested_lods=block.requested_lods,
+            target_bitrates_kbps=bandwidth[indices],
+        )
+
     def apply_network_trace(
         self,
         samples: list[TraceSample],
@@ -177,6 +260,23 @@ class HeadlessTraceReplayer:
             )
         return applied
 
+    def build_datagrams_from_block(self, block: TraceBlock) -> list[UplinkDatagram]:
+        """Convert a (truncated) trace block into canonical uplink datagrams."""
+        timestamps = block.timestamps_ms.tolist()
+        matrices = block.camera_matrices.tolist()
+        lods = block.requested_lods.tolist()
+        bitrates = block.target_bitrates_kbps.tolist()
+        return [
+            UplinkDatagram(
+                seq_id=seq_id,
+                timestamp_ms=timestamps[seq_id],
+                camera_matrix_4x4=matrices[seq_id],
+                requested_lod=lods[seq_id],
+                target_bitrate_kbps=int(bitrates[seq_id]),
+            )
+            for seq_id in range(len(timestamps))
+        ]
+
     def build_datagrams(self, samples: list[TraceSample]) -> list[UplinkDatagram]:
         """Convert trace samples into canonical uplink datagrams."""
         datagrams: list[UplinkDatagram] = []
@@ -192,7 +292,7 @@ class HeadlessTraceReplayer:
             )
         return datagrams
 
-    def generate_orbit_samples(
+    def generate_orbit_block(
         self,
         center: tuple[float, float, float],
         radius: float,
@@ -201,26 +301,46 @@ class HeadlessTraceReplayer:
         elevation_scale: float = 0.25,
         requested_lod: str = "full",
         target_bitrate_kbps: int = 4000,
-    ) -> list[TraceSample]:
-        """Generate a deterministic orbit trace for headless render experiments."""
-        samples: list[TraceSample] = []
+    ) -> TraceBlock:
+        """Generate a deterministic orbit trace as a structure-of-arrays block."""
         safe_frame_count = max(1, num_frames)
         safe_fps = max(1, fps)
 
-        for frame_idx in range(safe_frame_count):
-            angle = (2.0 * math.pi * frame_idx) / safe_frame_count
-            eye = (
-                center[0] + radius * math.cos(angle),
-                center[1] + radius * elevation_scale,
-                center[2] + radius * math.sin(angle),
-            )
-            matrix = self._look_at_camera_to_world(eye, center)
-            samples.append(
-                TraceSample(
-                    timestamp_ms=(frame_idx * 1000.0) / safe_fps,
-                    camera_matrix_4x4=matrix,
-                    requested_lod=requested_lod,
-                    target_bitrate_kbps=target_bitrate_kbps,
-                )
-            )
-        return samples
+        angles = (2.0 * math.pi / safe_frame_count) * np.arange(safe_frame_count)
+        eyes = np.stack(
+            [
+                center[0] + radius * np.cos(angles),
+                np.full(safe_frame_count, center[1] + radius * elevation_scale),
+                center[2] + radius * np.sin(angles),
+            ],
+            axis=1,
+        )
+        matrices = self._look_at_batch(eyes, np.asarray(center, dtype=np.float64))
+        timestamps = np.arange(safe_frame_count, dtype=np.float64) * (1000.0 / safe_fps)
+        return TraceBlock(
+            timestamps_ms=timestamps,
+            camera_matrices=matrices,
+            requested_lods=np.full(safe_frame_count, requested_lod),
+            target_bitrates_kbps=np.full(safe_frame_count, int(target_bitrate_kbps), dtype=np.int64),
+        )
+
+    def generate_orbit_samples(
+        self,
+        center: tuple[float, float, float],
+        radius: float,
+        num_frames: int = 120,
+        fps: int = 30,
+        elevation_scale: float = 0.25,
+        requested_lod: str = "full",
+        target_bitrate_kbps: int = 4000,
+    ) -> list[TraceSample]:
+        """Generate a deterministic orbit trace for headless render experiments."""
+        return self.generate_orbit_block(
+            center=center,
+            radius=radius,
+            num_frames=num_frames,
+            fps=fps,
+            elevation_scale=elevation_scale,
+            requested_lod=requested_lod,
+            target_bitrate_kbps=target_bitrate_kbps,
+        ).to_samples()
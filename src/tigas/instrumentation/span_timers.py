@@ -0,0 +1,85 @@
+"""Opt-in monotonic span timers for hot-path stage breakdowns.
+
+Instrumented code calls `begin()`/`end()` around named sub-stages; a
+disabled recorder reduces both to a single attribute check, so the probes
+can stay in place permanently without measurable overhead.
+"""
+
+from __future__ import annotations
+
+import time
+from typing import Dict, List, Optional
+
+from tigas.instrumentation.metrics_adapter import MetricsBufferAdapter
+from tigas.shared.types import MetricEvent
+
+
+class SpanRecorder:
+    """Collects named monotonic-clock spans and aggregates them per stage.
+
+    The begin/end protocol deliberately avoids context managers so the hot
+    path allocates nothing: callers keep the start timestamp in a local.
+    When a metrics adapter is attached, every completed span is also pushed
+    through its non-blocking ring buffer as a `MetricEvent` whose
+    `event_type` is the stage name.
+    """
+
+    __slots__ = ("enabled", "component", "_metrics", "_durations_us")
+
+    def __init__(
+        self,
+        enabled: bool = True,
+        component: str = "renderer",
+        metrics: Optional[MetricsBufferAdapter] = None,
+    ) -> None:
+        self.enabled = bool(enabled)
+        self.component = component
+        self._metrics = metrics
+        self._durations_us: Dict[str, List[float]] = {}
+
+    def begin(self) -> int:
+        """Return a span start timestamp, or 0 when disabled."""
+        if not self.enabled:
+            return 0
+        return time.monotonic_ns()
+
+    def end(self, stage: str, start_ns: int) -> None:
+        """Close the span opened at `start_ns` and attribute it to `stage`."""
+        if not self.enabled:
+            return
+        end_ns = time.monotonic_ns()
+        duration_us = (end_ns - start_ns) / 1000.0
+
+        bucket = self._durations_us.get(stage)
+        if bucket is None:
+            bucket = self._durations_us[stage] = []
+        bucket.append(duration_us)
+
+        if self._metrics is not None:
+            self._metrics.write_event(
+                MetricEvent(
+                    component=self.component,
+                    event_type=stage,
+                    timestamp_ns=end_ns,
+                    duration_us=duration_us,
+                )
+            )
+
+    def summarize(self) -> Dict[str, Dict[str, float]]:
+        """Aggregate recorded spans into per-stage mean/p95/max milliseconds."""
+        summary: Dict[str, Dict[str, float]] = {}
+        for stage, durations_us in self._durations_us.items():
+            ordered = sorted(durations_us)
+            p95_index = min(len(ordered) - 1, int(round(0.95 * (len(ordered) - 1))))
+            summary[stage] = {
+                "count": float(len(ordered)),
+                "mean_ms": (sum(ordered) / len(ordered)) / 1000.0,
+                "p95_ms": ordered[p95_index] / 1000.0,
+                "max_ms": ordered[-1] / 1000.0,
+            }
+        return summary
+
+
+# Shared disabled recorder: instrumented components default to this so their
+# probes cost one `enabled` check per span when timing is not requested.
+NULL_RECORDER = SpanRecorder(enabled=False)
@@ -8,6 +8,9 @@ elevated capabilities depending on host configuration.
 from __future__ import annotations
 
 import subprocess
+import threading
+import time
+from typing import Sequence
 
 
 class TcProfileManager:
@@ -66,3 +69,123 @@ class TcProfileManager:
     def clear(self, interface_name: str) -> None:
         """Clear active qdisc from interface."""
         self._run(["tc", "qdisc", "del", "dev", interface_name, "root"])
+
+
+class AsyncTcShaper:
+    """Applies a precompiled bandwidth schedule off the run loop.
+
+    The schedule is compiled once up front from trace timestamps and rates
+    (consecutive duplicate rates are collapsed), and mid-run changes are
+    streamed to a single persistent `tc -batch -` process from a dedicated
+    thread. The run loop never forks a subprocess or waits on tc, so the
+    shaper cannot inject stalls into the latency it exists to emulate.
+    """
+
+    def __init__(
+        self,
+        interface_name: str,
+        timestamps_ms: Sequence[float],
+        rates_kbps: Sequence[int],
+        burst_kbit: int = 64,
+        latency_ms: int = 50,
+    ) -> None:
+        if not interface_name:
+            raise ValueError("AsyncTcShaper requires an interface name.")
+        if len(timestamps_ms) == 0 or len(timestamps_ms) != len(rates_kbps):
+            raise ValueError("Schedule requires equal-length, non-empty timestamps and rates.")
+
+        self.interface_name = interface_name
+        self._burst_kbit = max(1, int(burst_kbit))
+        self._latency_ms = max(1, int(latency_ms))
+
+        first_ms = float(timestamps_ms[0])
+        schedule: list[tuple[float, int]] = []
+        previous_rate: int | None = None
+        for timestamp_ms, rate_kbps in zip(timestamps_ms, rates_kbps):
+            safe_rate = max(1, int(rate_kbps))
+            if safe_rate == previous_rate:
+                continue
+            schedule.append(((float(timestamp_ms) - first_ms) / 1000.0, safe_rate))
+            previous_rate = safe_rate
+
+        self._schedule = schedule
+        self.steps_total = len(schedule)
+        self.steps_applied = 0
+        self.status = "idle"
+        self._stop_event = threading.Event()
+        self._thread: threading.Thread | None = None
+        self._process: subprocess.Popen | None = None
+
+    def _command_line(self, verb: str, rate_kbps: int) -> str:
+        return (
+            f"qdisc {verb} dev {self.interface_name} root tbf "
+            f"rate {rate_kbps}kbit burst {self._burst_kbit}kbit latency {self._latency_ms}ms"
+        )
+
+    def start(self) -> None:
+        """Apply the first rate synchronously and launch the shaper thread.
+
+        The initial `tc qdisc replace` is the only blocking call and happens
+        before the run loop starts; raising here lets callers fall back to
+        unshapen execution the same way `TcProfileManager` failures do.
+        """
+        if self._thread is not None:
+            raise RuntimeError("AsyncTcShaper is already started.")
+
+        TcProfileManager().apply_rate_kbps(
+            interface_name=self.interface_name,
+            rate_kbps=self._schedule[0][1],
+            burst_kbit=self._burst_kbit,
+            latency_ms=self._latency_ms,
+        )
+        self.steps_applied = 1
+
+        self._process = subprocess.Popen(
+            ["tc", "-force", "-batch", "-"],
+            stdin=subprocess.PIPE,
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.DEVNULL,
+            text=True,
+        )
+        self.status = "active"
+        self._thread = threading.Thread(target=self._run, name="tigas-tc-shaper", daemon=True)
+        self._thread.start()
+
+    def _run(self) -> None:
+        base_s = time.perf_counter()
+        for offset_s, rate_kbps in self._schedule[1:]:
+            delay_s = base_s + offset_s - time.perf_counter()
+            if delay_s > 0.0 and self._stop_event.wait(delay_s):
+                return
+            if self._stop_event.is_set():
+                return
+            try:
+                assert self._process is not None and self._process.stdin is not None
+                self._process.stdin.write(self._command_line("change", rate_kbps) + "\n")
+                self._process.stdin.flush()
+            except (BrokenPipeError, OSError):
+                self.status = "failed:batch_pipe"
+                return
+            self.steps_applied += 1
+
+    def stop(self) -> None:
+        """Stop the shaper thread, end the batch process, and clear the qdisc."""
+        self._stop_event.set()
+        if self._thread is not None:
+            self._thread.join(timeout=2.0)
+            self._thread = None
+        if self._process is not None:
+            try:
+                if self._process.stdin is not None:
+                    self._process.stdin.close()
+                self._process.wait(timeout=2.0)
+            except (OSError, subprocess.TimeoutExpired):
+                self._process.kill()
+            self._process = None
+            try:
+                TcProfileManager().clear(self.interface_name)
+            except RuntimeError:
+                if self.status == "active":
+                    self.status = "clear_failed"
+        if self.status == "active":
+            self.status = "stopped"
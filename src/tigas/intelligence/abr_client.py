@@ -13,6 +13,8 @@ from dataclasses import dataclass
 from pathlib import Path
 from typing import Protocol
 
+import numpy as np
+
 
 @dataclass(slots=True)
 class ClientAbrDecision:
@@ -22,6 +24,28 @@ class ClientAbrDecision:
     requested_lod: str
 
 
+@dataclass(slots=True)
+class BatchAbrDecisions:
+    """Vectorized decision arrays for offline policy sweeps.
+
+    Stays in array form like `TraceBlock`; call `to_decisions()` only when
+    per-sample objects are actually needed.
+    """
+
+    target_bitrate_kbps: np.ndarray
+    requested_lods: np.ndarray
+
+    def __len__(self) -> int:
+        return int(self.target_bitrate_kbps.shape[0])
+
+    def to_decisions(self) -> list[ClientAbrDecision]:
+        """Materialize per-sample `ClientAbrDecision` objects."""
+        return [
+            ClientAbrDecision(target_bitrate_kbps=int(bitrate), requested_lod=str(lod))
+            for bitrate, lod in zip(self.target_bitrate_kbps.tolist(), self.requested_lods.tolist())
+        ]
+
+
 class ClientAbrController(Protocol):
     """Policy interface implemented by concrete ABR algorithms."""
 
@@ -33,6 +57,13 @@ class ClientAbrController(Protocol):
     ) -> ClientAbrDecision:
         """Return bitrate and LOD request based on client conditions."""
 
+    def decide_batch(
+        self,
+        throughput_kbps: np.ndarray,
+        buffer_level_ms: np.ndarray,
+    ) -> BatchAbrDecisions:
+        """Return decisions for whole throughput/buffer trace arrays."""
+
 
 @dataclass(slots=True)
 class AbrProfile:
@@ -105,12 +136,21 @@ class ThroughputEstimator:
 
 
 class _BaseProfiledClientAbr:
-    """Shared helpers for profile-driven ABR controllers."""
+    """Shared helpers for profile-driven ABR controllers.
+
+    The bitrate ladder and LOD mapping are precomputed as NumPy tables once
+    per controller so both the scalar runtime path and `decide_batch` avoid
+    per-decision list scans.
+    """
 
     def __init__(self, profile: AbrProfile) -> None:
         self.profile = profile
         self.bitrates = sorted(profile.bitrates_kbps)
         self.lods = profile.lods
+        self._ladder = np.asarray(self.bitrates, dtype=np.float64)
+        self._ladder_int = np.asarray(self.bitrates, dtype=np.int64)
+        self._lod_table = np.asarray(self.lods, dtype=object)
+        self._lod_index_by_bitrate = {bitrate: idx for idx, bitrate in enumerate(self.bitrates)}
 
     def _clamp(self, bitrate_kbps: float) -> int:
         bounded = min(self.profile.max_bitrate_kbps, max(self.profile.min_bitrate_kbps, bitrate_kbps))
@@ -126,8 +166,31 @@ class _BaseProfiledClientAbr:
         return selected
 
     def _lod_for(self, bitrate_kbps: int) -> str:
-        index = self.bitrates.index(bitrate_kbps)
-        return self.lods[index]
+        return self.lods[self._lod_index_by_bitrate[bitrate_kbps]]
+
+    def _validate_batch(
+        self, throughput_kbps: np.ndarray, buffer_level_ms: np.ndarray
+    ) -> tuple[np.ndarray, np.ndarray]:
+        throughput = np.asarray(throughput_kbps, dtype=np.float64)
+        buffer_ms = np.asarray(buffer_level_ms, dtype=np.float64)
+        if throughput.ndim != 1 or buffer_ms.ndim != 1:
+            raise ValueError("Batch ABR inputs must be one-dimensional arrays.")
+        if throughput.shape[0] != buffer_ms.shape[0]:
+            raise ValueError("Batch ABR throughput and buffer arrays must have equal length.")
+        if throughput.shape[0] == 0:
+            raise ValueError("Batch ABR inputs must be non-empty.")
+        return throughput, buffer_ms
+
+    def _nearest_lte_indices(self, targets_kbps: np.ndarray) -> np.ndarray:
+        """Vectorized `_select_nearest_lte`: largest ladder rung <= target."""
+        indices = np.searchsorted(self._ladder, targets_kbps, side="right") - 1
+        return np.maximum(indices, 0)
+
+    def _decisions_from_indices(self, indices: np.ndarray) -> BatchAbrDecisions:
+        return BatchAbrDecisions(
+            target_bitrate_kbps=self._ladder_int[indices],
+            requested_lods=self._lod_table[indices],
+        )
 
 
 class ThroughputClientAbr(_BaseProfiledClientAbr):
@@ -145,10 +208,31 @@ class ThroughputClientAbr(_BaseProfiledClientAbr):
         selected = self._select_nearest_lte(target)
         return ClientAbrDecision(target_bitrate_kbps=selected, requested_lod=self._lod_for(selected))
 
+    def decide_batch(
+        self,
+        throughput_kbps: np.ndarray,
+        buffer_level_ms: np.ndarray,
+    ) -> BatchAbrDecisions:
+        """Vectorized `decide` over whole trace arrays."""
+        throughput, _ = self._validate_batch(throughput_kbps, buffer_level_ms)
+        targets = np.clip(
+            throughput * self.profile.safety_factor,
+            self.profile.min_bitrate_kbps,
+            self.profile.max_bitrate_kbps,
+        )
+        return self._decisions_from_indices(self._nearest_lte_indices(np.round(targets)))
+
 
 class BolaClientAbr(_BaseProfiledClientAbr):
     """Buffer-based adaptation approximating BOLA objective ranking."""
 
+    def __init__(self, profile: AbrProfile) -> None:
+        super().__init__(profile)
+        # Utility and cost terms depend only on the ladder; precomputing
+        # them makes the batch objective one (N, L) broadcast.
+        self._utility = profile.bola_v * (self._ladder / self._ladder[0])
+        self._inv_cost = 1.0 / np.maximum(1.0, self._ladder)
+
     def decide(
         self,
         throughput_kbps: float,
@@ -170,6 +254,22 @@ class BolaClientAbr(_BaseProfiledClientAbr):
         capped = min(best_bitrate, self._select_nearest_lte(throughput_kbps * 1.05))
         return ClientAbrDecision(target_bitrate_kbps=capped, requested_lod=self._lod_for(capped))
 
+    def decide_batch(
+        self,
+        throughput_kbps: np.ndarray,
+        buffer_level_ms: np.ndarray,
+    ) -> BatchAbrDecisions:
+        """Vectorized `decide` over whole trace arrays."""
+        throughput, buffer_ms = self._validate_batch(throughput_kbps, buffer_level_ms)
+        buffer_s = np.maximum(0.0, buffer_ms / 1000.0)
+
+        scores = (buffer_s[:, None] * self._utility[None, :] + self.profile.bola_gamma) * (
+            self._inv_cost[None, :]
+        )
+        best_indices = np.argmax(scores, axis=1)
+        cap_indices = self._nearest_lte_indices(throughput * 1.05)
+        return self._decisions_from_indices(np.minimum(best_indices, cap_indices))
+
 
 class RobustMpcClientAbr(_BaseProfiledClientAbr):
     """Short-horizon MPC-style selection using throughput history."""
@@ -178,6 +278,7 @@ class RobustMpcClientAbr(_BaseProfiledClientAbr):
         super().__init__(profile)
         self._history = deque(maxlen=max(2, profile.robustmpc_horizon * 2))
         self._last_choice = self.bitrates[0]
+        self._quality = self._ladder / self._ladder[-1]
 
     def _predict_throughput(self, fallback_kbps: float) -> float:
         if not self._history:
@@ -221,6 +322,49 @@ class RobustMpcClientAbr(_BaseProfiledClientAbr):
             requested_lod=self._lod_for(best_bitrate),
         )
 
+    def decide_batch(
+        self,
+        throughput_kbps: np.ndarray,
+        buffer_level_ms: np.ndarray,
+    ) -> BatchAbrDecisions:
+        """Vectorized MPC objective over whole trace arrays.
+
+        The harmonic-mean throughput prediction uses a trailing window the
+        same size as the scalar path's history deque. The switch penalty is
+        applied against the previous sample's unpenalized choice (one-step
+        lag) so the whole objective stays a single (N, L) broadcast; exact
+        for `robustmpc_switch_penalty=0` and a close approximation
+        otherwise. Batch evaluation does not touch the scalar path's
+        history or last-choice state.
+        """
+        throughput, buffer_ms = self._validate_batch(throughput_kbps, buffer_level_ms)
+        count = throughput.shape[0]
+        window = max(2, self.profile.robustmpc_horizon * 2)
+
+        # Trailing harmonic mean over the last `window` samples, inclusive.
+        inverse = 1.0 / np.maximum(1.0, throughput)
+        padded = np.concatenate((np.zeros(1), np.cumsum(inverse)))
+        lengths = np.minimum(np.arange(1, count + 1), window)
+        trailing_sums = padded[1:] - padded[np.arange(1, count + 1) - lengths]
+        predicted = np.maximum(1.0, lengths / trailing_sums)
+
+        buffer_s = np.maximum(0.0, buffer_ms / 1000.0)
+        horizon = max(1, self.profile.robustmpc_horizon)
+        projected_download_s = (self._ladder[None, :] * horizon) / predicted[:, None]
+        projected_rebuffer_s = np.maximum(0.0, projected_download_s - buffer_s[:, None])
+        base = self._quality[None, :] - (
+            self.profile.robustmpc_rebuffer_penalty * projected_rebuffer_s
+        )
+
+        raw_indices = np.argmax(base, axis=1)
+        previous_kbps = np.empty(count, dtype=np.float64)
+        previous_kbps[0] = float(self.bitrates[0])
+        previous_kbps[1:] = self._ladder[raw_indices[:-1]]
+
+        switch_term = np.abs(self._ladder[None, :] - previous_kbps[:, None]) / self._ladder[-1]
+        objective = base - self.profile.robustmpc_switch_penalty * switch_term
+        return self._decisions_from_indices(np.argmax(objective, axis=1))
+
 
 def resolve_abr_profile(profile_arg: str | None) -> Path | None:
     """Resolve ABR profile by absolute path, relative path, or profile name."""
@@ -1,23 +1,351 @@
-"""Kalman pose predictor placeholder.
+"""Kalman pose predictor.
 
-Intended implementation:
+Splits each pose into a translation state (constant-velocity Kalman filter
+over position and velocity) and an orientation state (quaternion base pose
+with a filtered body angular velocity), maintained per stream id. Prediction
+extrapolates both states to the requested RTT horizon and derives confidence
+from covariance growth over that horizon.
 
-1. Split pose into translation and orientation state vectors.
-2. Maintain a Kalman state per stream id.
-3. Predict forward by measured or estimated RTT horizon.
-4. Emit confidence based on covariance growth.
+Performance notes: every per-stream matrix (state, covariance, transition,
+gain and scratch buffers) is preallocated at stream creation and updated in
+place, so the scalar `predict` path allocates only quaternion-sized
+temporaries and the returned pose. `predict_batch` applies the steady-state
+(fixed-gain) form of the same filter so replay mode can precompute
+predictions for an entire trace in one vectorized pass.
 """
 
 from __future__ import annotations
 
+import numpy as np
+
 from tigas.intelligence.predictor_base import PosePredictor
 from tigas.shared.types import PosePrediction, UplinkDatagram
 
+_EPS = 1e-12
+
+
+def _quat_multiply(a: np.ndarray, b: np.ndarray) -> np.ndarray:
+    """Hamilton product of (w, x, y, z) quaternions; broadcasts over rows."""
+    aw, ax, ay, az = a[..., 0], a[..., 1], a[..., 2], a[..., 3]
+    bw, bx, by, bz = b[..., 0], b[..., 1], b[..., 2], b[..., 3]
+    return np.stack(
+        [
+            aw * bw - ax * bx - ay * by - az * bz,
+            aw * bx + ax * bw + ay * bz - az * by,
+            aw * by - ax * bz + ay * bw + az * bx,
+            aw * bz + ax * by - ay * bx + az * bw,
+        ],
+        axis=-1,
+    )
+
+
+def _quat_conjugate(q: np.ndarray) -> np.ndarray:
+    out = q.copy()
+    out[..., 1:] = -out[..., 1:]
+    return out
+
+
+def _quat_log(q: np.ndarray) -> np.ndarray:
+    """Map unit quaternions to rotation vectors (axis * angle)."""
+    vec = q[..., 1:]
+    sin_half = np.linalg.norm(vec, axis=-1, keepdims=True)
+    angle = 2.0 * np.arctan2(sin_half, q[..., :1])
+    return np.where(sin_half < _EPS, 0.0, vec * (angle / np.maximum(sin_half, _EPS)))
+
+
+def _quat_exp(rotvec: np.ndarray) -> np.ndarray:
+    """Map rotation vectors (axis * angle) to unit quaternions."""
+    angle = np.linalg.norm(rotvec, axis=-1, keepdims=True)
+    half = 0.5 * angle
+    axis = np.where(angle < _EPS, 0.0, rotvec / np.maximum(angle, _EPS))
+    return np.concatenate([np.cos(half), axis * np.sin(half)], axis=-1)
+
+
+def _quats_from_matrices(rotations: np.ndarray) -> np.ndarray:
+    """Convert (N, 3, 3) rotation matrices to (N, 4) quaternions."""
+    m = rotations
+    m00, m11, m22 = m[:, 0, 0], m[:, 1, 1], m[:, 2, 2]
+    traces = np.stack(
+        [
+            1.0 + m00 + m11 + m22,
+            1.0 + m00 - m11 - m22,
+            1.0 - m00 + m11 - m22,
+            1.0 - m00 - m11 + m22,
+        ],
+        axis=1,
+    )
+    roots = 0.5 * np.sqrt(np.maximum(traces, _EPS))
+    inv4 = 1.0 / (4.0 * roots)
+
+    sub21_12 = m[:, 2, 1] - m[:, 1, 2]
+    sub02_20 = m[:, 0, 2] - m[:, 2, 0]
+    sub10_01 = m[:, 1, 0] - m[:, 0, 1]
+    add01_10 = m[:, 0, 1] + m[:, 1, 0]
+    add02_20 = m[:, 0, 2] + m[:, 2, 0]
+    add12_21 = m[:, 1, 2] + m[:, 2, 1]
+
+    candidates = np.stack(
+        [
+            np.stack([roots[:, 0], sub21_12 * inv4[:, 0], sub02_20 * inv4[:, 0], sub10_01 * inv4[:, 0]], axis=1),
+            np.stack([sub21_12 * inv4[:, 1], roots[:, 1], add01_10 * inv4[:, 1], add02_20 * inv4[:, 1]], axis=1),
+            np.stack([sub02_20 * inv4[:, 2], add01_10 * inv4[:, 2], roots[:, 2], add12_21 * inv4[:, 2]], axis=1),
+            np.stack([sub10_01 * inv4[:, 3], add02_20 * inv4[:, 3], add12_21 * inv4[:, 3], roots[:, 3]], axis=1),
+        ],
+        axis=1,
+    )
+    best = np.argmax(traces, axis=1)
+    quats = candidates[np.arange(m.shape[0]), best]
+    return quats / np.maximum(np.linalg.norm(quats, axis=1, keepdims=True), _EPS)
+
+
+def _quats_to_matrices(quats: np.ndarray) -> np.ndarray:
+    """Convert (N, 4) quaternions to (N, 3, 3) rotation matrices."""
+    w, x, y, z = quats[:, 0], quats[:, 1], quats[:, 2], quats[:, 3]
+    out = np.empty((quats.shape[0], 3, 3), dtype=np.float64)
+    out[:, 0, 0] = 1.0 - 2.0 * (y * y + z * z)
+    out[:, 0, 1] = 2.0 * (x * y - z * w)
+    out[:, 0, 2] = 2.0 * (x * z + y * w)
+    out[:, 1, 0] = 2.0 * (x * y + z * w)
+    out[:, 1, 1] = 1.0 - 2.0 * (x * x + z * z)
+    out[:, 1, 2] = 2.0 * (y * z - x * w)
+    out[:, 2, 0] = 2.0 * (x * z - y * w)
+    out[:, 2, 1] = 2.0 * (y * z + x * w)
+    out[:, 2, 2] = 1.0 - 2.0 * (x * x + y * y)
+    return out
+
+
+def _trailing_mean(values: np.ndarray, window: int) -> np.ndarray:
+    """Trailing moving average along axis 0 via cumulative sums."""
+    count = values.shape[0]
+    if count <= 1 or window <= 1:
+        return values
+    padded = np.zeros((count + 1,) + values.shape[1:], dtype=np.float64)
+    np.cumsum(values, axis=0, out=padded[1:])
+    idx = np.arange(count)
+    start = np.maximum(0, idx - window + 1)
+    spans = (idx - start + 1).astype(np.float64).reshape((-1,) + (1,) * (values.ndim - 1))
+    return (padded[idx + 1] - padded[start]) / spans
+
+
+class _StreamState:
+    """Preallocated Kalman state for one pose stream."""
+
+    __slots__ = (
+        "x",
+        "covariance",
+        "transition",
+        "process_noise",
+        "quat",
+        "omega",
+        "omega_var",
+        "last_timestamp_ms",
+        "_identity6",
+        "_x_next",
+        "_work63",
+        "_work66",
+        "_gain",
+        "_innovation",
+        "_s_buf",
+        "_s_inv",
+    )
+
+    def __init__(self, initial_variance: float) -> None:
+        self.x = np.zeros(6, dtype=np.float64)
+        self.covariance = np.eye(6, dtype=np.float64) * initial_variance
+        self.transition = np.eye(6, dtype=np.float64)
+        self.process_noise = np.zeros((6, 6), dtype=np.float64)
+        self.quat = np.array([1.0, 0.0, 0.0, 0.0], dtype=np.float64)
+        self.omega = np.zeros(3, dtype=np.float64)
+        self.omega_var = initial_variance
+        self.last_timestamp_ms: float | None = None
+
+        self._identity6 = np.eye(6, dtype=np.float64)
+        self._x_next = np.zeros(6, dtype=np.float64)
+        self._work63 = np.zeros((6, 3), dtype=np.float64)
+        self._work66 = np.zeros((6, 6), dtype=np.float64)
+        self._gain = np.zeros((6, 3), dtype=np.float64)
+        self._innovation = np.zeros(3, dtype=np.float64)
+        self._s_buf = np.zeros((3, 3), dtype=np.float64)
+        self._s_inv = np.zeros((3, 3), dtype=np.float64)
+
+
+def _invert_3x3(matrix: np.ndarray, out: np.ndarray) -> None:
+    """Cofactor inverse of a 3x3 matrix into a preallocated buffer."""
+    a, b, c = matrix[0]
+    d, e, f = matrix[1]
+    g, h, i = matrix[2]
+    det = a * (e * i - f * h) - b * (d * i - f * g) + c * (d * h - e * g)
+    inv_det = 1.0 / det if abs(det) > _EPS else 0.0
+    out[0, 0] = (e * i - f * h) * inv_det
+    out[0, 1] = (c * h - b * i) * inv_det
+    out[0, 2] = (b * f - c * e) * inv_det
+    out[1, 0] = (f * g - d * i) * inv_det
+    out[1, 1] = (a * i - c * g) * inv_det
+    out[1, 2] = (c * d - a * f) * inv_det
+    out[2, 0] = (d * h - e * g) * inv_det
+    out[2, 1] = (b * g - a * h) * inv_det
+    out[2, 2] = (a * e - b * d) * inv_det
+
 
 class KalmanPosePredictor(PosePredictor):
-    """Stateful predictor placeholder for low-latency camera extrapolation."""
+    """Stateful constant-velocity predictor for low-latency camera extrapolation."""
+
+    def __init__(
+        self,
+        position_process_noise: float = 0.5,
+        velocity_process_noise: float = 2.0,
+        measurement_noise: float = 1e-4,
+        angular_process_noise: float = 4.0,
+        angular_measurement_noise: float = 0.05,
+        initial_variance: float = 1.0,
+        batch_smoothing_window: int = 5,
+    ) -> None:
+        self._position_process_noise = float(position_process_noise)
+        self._velocity_process_noise = float(velocity_process_noise)
+        self._measurement_noise = float(measurement_noise)
+        self._angular_process_noise = float(angular_process_noise)
+        self._angular_measurement_noise = float(angular_measurement_noise)
+        self._initial_variance = float(initial_variance)
+        self._batch_smoothing_window = max(1, int(batch_smoothing_window))
+        self._states: dict[str, _StreamState] = {}
+
+    def _update_stream(
+        self,
+        state: _StreamState,
+        timestamp_ms: float,
+        position: np.ndarray,
+        quat: np.ndarray,
+    ) -> None:
+        if state.last_timestamp_ms is None:
+            state.x[:3] = position
+            state.x[3:] = 0.0
+            state.quat[:] = quat
+            state.last_timestamp_ms = timestamp_ms
+            return
+
+        dt = max(1e-3, (timestamp_ms - state.last_timestamp_ms) / 1000.0)
+        state.last_timestamp_ms = timestamp_ms
+
+        # Translation predict step: x = F x, P = F P F^T + Q(dt).
+        state.transition[0, 3] = state.transition[1, 4] = state.transition[2, 5] = dt
+        np.matmul(state.transition, state.x, out=state._x_next)
+        state.x[:] = state._x_next
+        np.matmul(state.transition, state.covariance, out=state._work66)
+        np.matmul(state._work66, state.transition.T, out=state.covariance)
+        noise_diag = np.einsum("ii->i", state.process_noise)
+        noise_diag[:3] = self._position_process_noise * dt
+        noise_diag[3:] = self._velocity_process_noise * dt
+        state.covariance += state.process_noise
+
+        # Translation update step against the measured position.
+        np.subtract(position, state.x[:3], out=state._innovation)
+        state._s_buf[:] = state.covariance[:3, :3]
+        state._s_buf[0, 0] += self._measurement_noise
+        state._s_buf[1, 1] += self._measurement_noise
+        state._s_buf[2, 2] += self._measurement_noise
+        _invert_3x3(state._s_buf, state._s_inv)
+        np.matmul(state.covariance[:, :3], state._s_inv, out=state._gain)
+        state.x += state._gain @ state._innovation
+        np.matmul(state._gain, state.covariance[:3, :], out=state._work66)
+        state.covariance -= state._work66
+
+        # Orientation: filter the body angular velocity implied by the
+        # quaternion step, then rebase on the measurement.
+        if float(np.dot(state.quat, quat)) < 0.0:
+            quat = -quat
+        delta = _quat_multiply(_quat_conjugate(state.quat), quat)
+        omega_measured = _quat_log(delta) / dt
+        state.omega_var += self._angular_process_noise * dt
+        gain = state.omega_var / (state.omega_var + self._angular_measurement_noise)
+        state.omega += gain * (omega_measured - state.omega)
+        state.omega_var *= 1.0 - gain
+        state.quat[:] = quat
+
+    def predict(
+        self,
+        datagram: UplinkDatagram,
+        rtt_ms: float,
+        stream_id: str = "default",
+    ) -> PosePrediction:
+        """Update the stream filter and extrapolate to the RTT horizon."""
+        state = self._states.get(stream_id)
+        if state is None:
+            state = _StreamState(self._initial_variance)
+            self._states[stream_id] = state
+
+        matrix = np.asarray(datagram.camera_matrix_4x4, dtype=np.float64).reshape((4, 4))
+        position = matrix[:3, 3]
+        quat = _quats_from_matrices(matrix[None, :3, :3])[0]
+
+        self._update_stream(state, datagram.timestamp_ms, position, quat)
+
+        horizon_s = max(0.0, rtt_ms) / 1000.0
+        predicted = matrix.copy()
+        predicted[:3, 3] = state.x[:3] + state.x[3:] * horizon_s
+        predicted_quat = _quat_multiply(state.quat, _quat_exp(state.omega * horizon_s))
+        predicted[:3, :3] = _quats_to_matrices(predicted_quat[None, :])[0]
+
+        position_var = float(np.trace(state.covariance[:3, :3]))
+        velocity_var = float(np.trace(state.covariance[3:, 3:]))
+        growth = position_var + (velocity_var + state.omega_var) * horizon_s * horizon_s
+        confidence = float(1.0 / (1.0 + growth))
 
-    def predict(self, datagram: UplinkDatagram, rtt_ms: float) -> PosePrediction:
-        raise NotImplementedError(
-            "Implement Kalman state update and prediction for pose matrices."
+        return PosePrediction(
+            predicted_matrix_4x4=predicted.reshape(16).tolist(),
+            prediction_horizon_ms=float(rtt_ms),
+            confidence=confidence,
         )
+
+    def predict_batch(
+        self,
+        timestamps_ms: np.ndarray,
+        camera_matrices: np.ndarray,
+        rtt_ms: float | np.ndarray,
+    ) -> tuple[np.ndarray, np.ndarray]:
+        """Predict every pose of a trace in one vectorized pass.
+
+        Applies the steady-state (fixed-gain) form of the filter: velocities
+        and angular rates come from finite differences smoothed with a
+        trailing window, then every sample is extrapolated by its horizon.
+        Returns `(predicted_matrices, confidences)` with shapes (N, 16) and
+        (N,).
+        """
+        timestamps_s = np.asarray(timestamps_ms, dtype=np.float64) / 1000.0
+        matrices = np.asarray(camera_matrices, dtype=np.float64).reshape((-1, 4, 4))
+        count = matrices.shape[0]
+        if timestamps_s.shape[0] != count:
+            raise ValueError("Batch prediction requires one timestamp per pose matrix.")
+        if count == 0:
+            return np.zeros((0, 16), dtype=np.float64), np.zeros((0,), dtype=np.float64)
+
+        horizon_s = np.broadcast_to(
+            np.maximum(0.0, np.asarray(rtt_ms, dtype=np.float64)) / 1000.0, (count,)
+        )
+
+        positions = matrices[:, :3, 3]
+        quats = _quats_from_matrices(matrices[:, :3, :3])
+        flips = np.where(np.sum(quats[1:] * quats[:-1], axis=1) < 0.0, -1.0, 1.0)
+        quats[1:] *= np.cumprod(flips)[:, None]
+
+        dt = np.maximum(1e-3, np.diff(timestamps_s))[:, None]
+        velocities = np.zeros_like(positions)
+        velocities[1:] = np.diff(positions, axis=0) / dt
+        omegas = np.zeros_like(positions)
+        omegas[1:] = _quat_log(_quat_multiply(_quat_conjugate(quats[:-1]), quats[1:])) / dt
+
+        smoothed_velocities = _trailing_mean(velocities, self._batch_smoothing_window)
+        smoothed_omegas = _trailing_mean(omegas, self._batch_smoothing_window)
+
+        predicted = matrices.copy()
+        predicted[:, :3, 3] = positions + smoothed_velocities * horizon_s[:, None]
+        predicted_quats = _quat_multiply(quats, _quat_exp(smoothed_omegas * horizon_s[:, None]))
+        predicted[:, :3, :3] = _quats_to_matrices(predicted_quats)
+
+        # Confidence mirrors the covariance heuristic: the larger the
+        # unsmoothed residual motion, the less the extrapolation is trusted.
+        residual = np.linalg.norm(velocities - smoothed_velocities, axis=1) + np.linalg.norm(
+            omegas - smoothed_omegas, axis=1
+        )
+        confidences = 1.0 / (1.0 + residual * horizon_s)
+
+        return predicted.reshape((count, 16)), confidences
@@ -1,17 +1,37 @@
-"""av1_nvenc encoder placeholder backend."""
+"""av1_nvenc encoder backend."""
 
 from __future__ import annotations
 
-from tigas.media.coder_interface import EncoderBackend
-from tigas.shared.types import EncodingPolicy, RawFrame
+from tigas.media.ffmpeg_pipe import PipeEncoderBackend
+from tigas.shared.types import EncodingPolicy
 
 
-class Av1NvencEncoder(EncoderBackend):
-    """Placeholder for NVIDIA AV1 hardware encoder integration."""
+class Av1NvencEncoder(PipeEncoderBackend):
+    """NVIDIA AV1 hardware encoding over a persistent ffmpeg pipe session."""
 
     @property
     def encoder_name(self) -> str:
         return "av1_nvenc"
 
-    def encode(self, frame: RawFrame, policy: EncodingPolicy) -> bytes:
-        raise NotImplementedError("Implement AV1 NVENC backend integration.")
+    def _output_format(self) -> str:
+        return "ivf"
+
+    def _encoder_args(self, policy: EncodingPolicy) -> list[str]:
+        args = [
+            "-c:v",
+            "av1_nvenc",
+            "-preset",
+            "p1",
+            "-tune",
+            "ll",
+            "-g",
+            str(max(1, policy.gop_size)),
+            "-pix_fmt",
+            "yuv420p",
+        ]
+        if policy.qp_hint is not None:
+            args += ["-rc", "constqp", "-qp", str(policy.qp_hint)]
+        else:
+            bitrate = f"{max(1, policy.target_bitrate_kbps)}k"
+            args += ["-rc", "cbr", "-b:v", bitrate, "-maxrate", bitrate, "-bufsize", bitrate]
+        return args
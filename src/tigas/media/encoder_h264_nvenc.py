@@ -1,17 +1,34 @@
-"""h264_nvenc encoder placeholder backend."""
+"""h264_nvenc encoder backend."""
 
 from __future__ import annotations
 
-from tigas.media.coder_interface import EncoderBackend
-from tigas.shared.types import EncodingPolicy, RawFrame
+from tigas.media.ffmpeg_pipe import PipeEncoderBackend
+from tigas.shared.types import EncodingPolicy
 
 
-class H264NvencEncoder(EncoderBackend):
-    """Placeholder for NVIDIA H.264 hardware encoder integration."""
+class H264NvencEncoder(PipeEncoderBackend):
+    """NVIDIA H.264 hardware encoding over a persistent ffmpeg pipe session."""
 
     @property
     def encoder_name(self) -> str:
         return "h264_nvenc"
 
-    def encode(self, frame: RawFrame, policy: EncodingPolicy) -> bytes:
-        raise NotImplementedError("Implement FFmpeg or NVENC binding integration.")
+    def _encoder_args(self, policy: EncodingPolicy) -> list[str]:
+        args = [
+            "-c:v",
+            "h264_nvenc",
+            "-preset",
+            "p1",
+            "-tune",
+            "ll",
+            "-g",
+            str(max(1, policy.gop_size)),
+            "-pix_fmt",
+            "yuv420p",
+        ]
+        if policy.qp_hint is not None:
+            args += ["-rc", "constqp", "-qp", str(policy.qp_hint)]
+        else:
+            bitrate = f"{max(1, policy.target_bitrate_kbps)}k"
+            args += ["-rc", "cbr", "-b:v", bitrate, "-maxrate", bitrate, "-bufsize", bitrate]
+        return args
@@ -1,17 +1,34 @@
-"""libx264 encoder placeholder backend."""
+"""libx264 encoder backend."""
 
 from __future__ import annotations
 
-from tigas.media.coder_interface import EncoderBackend
-from tigas.shared.types import EncodingPolicy, RawFrame
+from tigas.media.ffmpeg_pipe import PipeEncoderBackend
+from tigas.shared.types import EncodingPolicy
 
 
-class Libx264Encoder(EncoderBackend):
-    """Placeholder for software x264 encoding path."""
+class Libx264Encoder(PipeEncoderBackend):
+    """Software x264 encoding over a persistent ffmpeg pipe session."""
 
     @property
     def encoder_name(self) -> str:
         return "libx264"
 
-    def encode(self, frame: RawFrame, policy: EncodingPolicy) -> bytes:
-        raise NotImplementedError("Implement software libx264 encoding backend.")
+    def _encoder_args(self, policy: EncodingPolicy) -> list[str]:
+        args = [
+            "-c:v",
+            "libx264",
+            "-preset",
+            "veryfast",
+            "-tune",
+            "zerolatency",
+            "-g",
+            str(max(1, policy.gop_size)),
+            "-pix_fmt",
+            "yuv420p",
+        ]
+        if policy.qp_hint is not None:
+            args += ["-qp", str(policy.qp_hint)]
+        else:
+            bitrate = f"{max(1, policy.target_bitrate_kbps)}k"
+            args += ["-b:v", bitrate, "-maxrate", bitrate, "-bufsize", bitrate]
+        return args
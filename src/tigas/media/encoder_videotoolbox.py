@@ -1,17 +1,29 @@
-"""VideoToolbox encoder placeholder backend."""
+"""VideoToolbox encoder backend."""
 
 from __future__ import annotations
 
-from tigas.media.coder_interface import EncoderBackend
-from tigas.shared.types import EncodingPolicy, RawFrame
+from tigas.media.ffmpeg_pipe import PipeEncoderBackend
+from tigas.shared.types import EncodingPolicy
 
 
-class VideoToolboxEncoder(EncoderBackend):
-    """Placeholder for Apple VideoToolbox hardware encoding path."""
+class VideoToolboxEncoder(PipeEncoderBackend):
+    """Apple VideoToolbox hardware encoding over a persistent ffmpeg pipe session."""
 
     @property
     def encoder_name(self) -> str:
         return "videotoolbox_h264"
 
-    def encode(self, frame: RawFrame, policy: EncodingPolicy) -> bytes:
-        raise NotImplementedError("Implement macOS VideoToolbox encoder integration.")
+    def _encoder_args(self, policy: EncodingPolicy) -> list[str]:
+        bitrate = f"{max(1, policy.target_bitrate_kbps)}k"
+        return [
+            "-c:v",
+            "h264_videotoolbox",
+            "-realtime",
+            "1",
+            "-g",
+            str(max(1, policy.gop_size)),
+            "-b:v",
+            bitrate,
+            "-pix_fmt",
+            "yuv420p",
+        ]
@@ -0,0 +1,204 @@
+"""Persistent ffmpeg pipe sessions shared by the encoder backends.
+
+`FfmpegPipeSession` keeps one long-lived ffmpeg process per encoder: raw
+frames stream in over stdin and the compressed elementary stream is drained
+from stdout by a reader thread, so no per-frame process spawn or disk I/O
+happens on the encode path. `PipeEncoderBackend` layers the
+`EncoderBackend.encode(frame, policy)` contract on top: the session is
+created lazily from the first frame's geometry and restarted in place
+whenever `EncodingPolicy` bitrate/GOP (or the frame geometry) changes, which
+is how ffmpeg-CLI encoders reconfigure mid-stream — the new session opens on
+a fresh keyframe.
+"""
+
+from __future__ import annotations
+
+import shutil
+import subprocess
+import threading
+
+from tigas.media.coder_interface import EncoderBackend
+from tigas.shared.types import EncodingPolicy, RawFrame
+
+_READ_CHUNK_BYTES = 65536
+
+
+class FfmpegPipeSession:
+    """One long-lived ffmpeg encode process fed rawvideo over stdin."""
+
+    def __init__(
+        self,
+        encoder_args: list[str],
+        width: int,
+        height: int,
+        fps: int,
+        pixel_format: str = "rgb24",
+        output_format: str = "h264",
+        first_output_timeout_s: float = 5.0,
+    ) -> None:
+        if shutil.which("ffmpeg") is None:
+            raise RuntimeError("ffmpeg binary not found on PATH; encoder backends require it.")
+
+        command = [
+            "ffmpeg",
+            "-hide_banner",
+            "-loglevel",
+            "error",
+            "-f",
+            "rawvideo",
+            "-pix_fmt",
+            pixel_format,
+            "-s",
+            f"{width}x{height}",
+            "-r",
+            str(max(1, fps)),
+            "-i",
+            "-",
+            *encoder_args,
+            "-f",
+            output_format,
+            "-",
+        ]
+        self._process = subprocess.Popen(
+            command,
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+        )
+        self._first_output_timeout_s = float(first_output_timeout_s)
+        self._output = bytearray()
+        self._output_ready = threading.Condition()
+        self._produced_any = False
+        self._reader = threading.Thread(target=self._drain_stdout, name="tigas-ffmpeg-read", daemon=True)
+        self._reader.start()
+
+    def _drain_stdout(self) -> None:
+        assert self._process.stdout is not None
+        while True:
+            chunk = self._process.stdout.read(_READ_CHUNK_BYTES)
+            if not chunk:
+                return
+            with self._output_ready:
+                self._output.extend(chunk)
+                self._produced_any = True
+                self._output_ready.notify_all()
+
+    def _take_output(self) -> bytes:
+        with self._output_ready:
+            if not self._output:
+                return b""
+            taken = bytes(self._output)
+            self._output.clear()
+            return taken
+
+    def encode_frame(self, data: bytes | memoryview) -> bytes:
+        """Feed one raw frame and return compressed bytes produced so far.
+
+        Low-delay encoder settings emit one access unit per input frame in
+        steady state; during initial priming the encoder may hold frames, in
+        which case the pending bytes arrive with a later call or at `close`.
+        """
+        if self._process.poll() is not None:
+            raise RuntimeError(self._failure_message())
+        assert self._process.stdin is not None
+        try:
+            self._process.stdin.write(data)
+            self._process.stdin.flush()
+        except BrokenPipeError as exc:
+            raise RuntimeError(self._failure_message()) from exc
+
+        # Block only until the session proves it produces output at all;
+        # afterwards the encode path never waits on the pipe.
+        with self._output_ready:
+            if not self._produced_any:
+                self._output_ready.wait(timeout=self._first_output_timeout_s)
+        return self._take_output()
+
+    def close(self) -> bytes:
+        """Flush the encoder and return any trailing compressed bytes."""
+        if self._process.stdin is not None:
+            try:
+                self._process.stdin.close()
+            except BrokenPipeError:
+                pass
+        return_code = self._process.wait()
+        self._reader.join()
+        if return_code != 0:
+            raise RuntimeError(self._failure_message())
+        return self._take_output()
+
+    def abort(self) -> None:
+        """Terminate the session without flushing (error paths only)."""
+        self._process.kill()
+        self._process.wait()
+        self._reader.join()
+
+    def _failure_message(self) -> str:
+        detail = ""
+        if self._process.stderr is not None:
+            try:
+                detail = self._process.stderr.read().decode("utf-8", errors="replace").strip()
+            except ValueError:
+                detail = ""
+        return f"ffmpeg encode session failed: {detail or 'no diagnostic output'}"
+
+
+class PipeEncoderBackend(EncoderBackend):
+    """Shared persistent-session behavior for ffmpeg-pipe encoders.
+
+    Subclasses provide the codec-specific argument list; this base owns the
+    session lifecycle and policy-change detection.
+    """
+
+    def __init__(self, fps: int = 30) -> None:
+        self.fps = int(max(1, fps))
+        self._session: FfmpegPipeSession | None = None
+        self._active_key: tuple | None = None
+        self.session_generation = 0
+
+    def _encoder_args(self, policy: EncodingPolicy) -> list[str]:
+        raise NotImplementedError
+
+    def _output_format(self) -> str:
+        return "h264"
+
+    @staticmethod
+    def _policy_key(frame: RawFrame, policy: EncodingPolicy) -> tuple:
+        return (
+            frame.width,
+            frame.height,
+            frame.pixel_format,
+            policy.target_bitrate_kbps,
+            policy.gop_size,
+            policy.qp_hint,
+        )
+
+    def encode(self, frame: RawFrame, policy: EncodingPolicy) -> bytes:
+        """Encode one raw frame through the persistent session."""
+        key = self._policy_key(frame, policy)
+        flushed = b""
+        if self._session is not None and key != self._active_key:
+            flushed = self._session.close()
+            self._session = None
+        if self._session is None:
+            self._session = FfmpegPipeSession(
+                encoder_args=self._encoder_args(policy),
+                width=frame.width,
+                height=frame.height,
+                fps=self.fps,
+                pixel_format=frame.pixel_format,
+                output_format=self._output_format(),
+            )
+            self._active_key = key
+            self.session_generation += 1
+        return flushed + self._session.encode_frame(frame.data)
+
+    def close(self) -> bytes:
+        """End the active session and return trailing compressed bytes."""
+        if self._session is None:
+            return b""
+        try:
+            return self._session.close()
+        finally:
+            self._session = None
+            self._active_key = None
@@ -6,7 +6,9 @@ and reports render timing without writing evaluation artifacts.
 
 from __future__ import annotations
 
+import queue
 import statistics
+import threading
 import time
 from dataclasses import asdict
 from pathlib import Path
@@ -15,7 +17,9 @@ from typing import Callable
 import numpy as np
 
 from tigas.input_control.headless_replayer import HeadlessTraceReplayer
-from tigas.instrumentation.tc_profiles import TcProfileManager
+from tigas.instrumentation.metrics_adapter import MetricsBufferAdapter
+from tigas.instrumentation.span_timers import SpanRecorder
+from tigas.instrumentation.tc_profiles import AsyncTcShaper, TcProfileManager
 from tigas.intelligence.abr_client import (
     ThroughputEstimator,
     build_client_abr_controller,
@@ -25,15 +29,71 @@ from tigas.intelligence.abr_client import (
 from tigas.intelligence.abr_server import ServerAbrController
 from tigas.renderer.backend_cpu import CpuFallbackBackend
 from tigas.renderer.backend_gsplat import GsplatCudaBackend
-from tigas.shared.types import ExperimentConfig, RenderRequest, UplinkDatagram
+from tigas.shared.types import ExperimentConfig, MetricEvent, RenderRequest, UplinkDatagram
 
 FrameCallback = Callable[[bytes, int, int, int, UplinkDatagram, float], None]
 
 
+class _FrameSinkWorker:
+    """Runs frame callbacks on a worker thread behind a bounded queue.
+
+    A single worker keeps callback side effects (artifact writes, metric list
+    appends) ordered and thread-safe while letting the render loop start the
+    next frame immediately. The bounded queue back-pressures rendering if the
+    sink falls too far behind.
+    """
+
+    def __init__(self, frame_callback: FrameCallback, renderer, queue_depth: int = 4) -> None:
+        self._frame_callback = frame_callback
+        self._renderer = renderer
+        self._queue: queue.Queue = queue.Queue(maxsize=max(1, queue_depth))
+        self._error: BaseException | None = None
+        self._thread = threading.Thread(target=self._run, name="tigas-frame-sink", daemon=True)
+        self._thread.start()
+
+    def submit(self, frame, datagram: UplinkDatagram, render_ms: float) -> None:
+        if self._error is not None:
+            raise RuntimeError("Frame sink worker failed.") from self._error
+        self._queue.put((frame, datagram, render_ms))
+
+    def _run(self) -> None:
+        while True:
+            item = self._queue.get()
+            if item is None:
+                return
+            frame, datagram, render_ms = item
+            if self._error is not None:
+                continue
+            try:
+                self._frame_callback(
+                    frame.data,
+                    frame.width,
+                    frame.height,
+                    frame.frame_id,
+                    datagram,
+                    render_ms,
+                )
+                self._renderer.recycle(frame)
+            except BaseException as exc:  # noqa: BLE001 - re-raised on close
+                self._error = exc
+
+    def close(self) -> None:
+        """Drain pending frames and re-raise the first callback failure."""
+        self._queue.put(None)
+        self._thread.join()
+        if self._error is not None:
+            raise RuntimeError("Frame sink worker failed.") from self._error
+
+
 class HeadlessAblationRunner:
     """Runtime renderer loop for headless execution."""
 
-    def _build_renderer(self, config: ExperimentConfig, point_cloud_path: Path):
+    def _build_renderer(
+        self,
+        config: ExperimentConfig,
+        point_cloud_path: Path,
+        span_recorder: SpanRecorder | None = None,
+    ):
         if config.renderer_backend == "gsplat_cuda":
             return GsplatCudaBackend(
                 point_cloud_path=str(point_cloud_path),
@@ -41,6 +101,7 @@ class HeadlessAblationRunner:
                 height=config.height,
                 max_points=config.max_points,
                 quant_bits=config.quant_bits,
+                async_readback=config.gpu_async_readback,
             )
 
         return CpuFallbackBackend(
@@ -49,6 +110,8 @@ class HeadlessAblationRunner:
             height=config.height,
             max_points=config.max_points,
             quant_bits=config.quant_bits,
+            raster_engine=config.cpu_raster_engine,
+            span_recorder=span_recorder,
         )
 
     def _resolve_point_cloud_path(self, config: ExperimentConfig) -> Path:
@@ -88,11 +151,11 @@ class HeadlessAblationRunner:
         replayer = HeadlessTraceReplayer()
         trace_json = self._resolve_trace_input(config.trace_path, "movement_traces", ".json")
         if trace_json and trace_json.suffix.lower() == ".json":
-            samples = replayer.load_trace(str(trace_json))
+            block = replayer.load_trace_block(str(trace_json))
             trace_source = str(trace_json)
         else:
             orbit_radius = max(renderer.scene_radius * 2.2, 0.4)
-            samples = replayer.generate_orbit_samples(
+            block = replayer.generate_orbit_block(
                 center=renderer.scene_center,
                 radius=orbit_radius,
                 num_frames=config.num_frames,
@@ -108,21 +171,57 @@ class HeadlessAblationRunner:
         )
         if network_trace is not None:
             bandwidth_kbps = replayer.load_network_trace(str(network_trace))
-            samples = replayer.apply_network_trace(samples=samples, bandwidth_kbps=bandwidth_kbps)
+            block = replayer.apply_network_trace_block(block=block, bandwidth_kbps=bandwidth_kbps)
             trace_source = f"{trace_source};network={network_trace}"
 
-        datagrams = replayer.build_datagrams(samples)
-        if config.num_frames > 0 and len(datagrams) > config.num_frames:
-            datagrams = datagrams[: config.num_frames]
-
-        return datagrams, trace_source
+        # Stay in array form until after truncation so million-sample traces
+        # never materialize per-sample objects they will not replay.
+        if config.num_frames > 0:
+            block = block.truncate(config.num_frames)
+
+        return replayer.build_datagrams_from_block(block), trace_source
+
+    def run_one(
+        self,
+        config: ExperimentConfig,
+        frame_callback: FrameCallback | None = None,
+        renderer=None,
+    ) -> dict:
+        """Execute one runtime render pass and return timing summary.
+
+        When `renderer` is provided (the render-service warm path), it must
+        already be initialized and match the config's scene and resolution;
+        the runner borrows it for this run and leaves shutdown to its owner.
+        Renderer-internal span timers only attach at construction, so borrowed
+        renderers report runner-side stages only.
+        """
+        if config.realtime_pacing and config.pipeline_mode != "serial":
+            raise ValueError(
+                "Real-time pacing requires pipeline_mode='serial'; the pacing loop "
+                "is the timing authority and cannot share it with a sink worker."
+            )
 
-    def run_one(self, config: ExperimentConfig, frame_callback: FrameCallback | None = None) -> dict:
-        """Execute one runtime render pass and return timing summary."""
         point_cloud_path = self._resolve_point_cloud_path(config)
 
-        renderer = self._build_renderer(config=config, point_cloud_path=point_cloud_path)
-        renderer.initialize()
+        # Metrics and span recorders are created before the renderer so the
+        # backend's sub-stage probes can feed the same ring buffer.
+        metrics: MetricsBufferAdapter | None = None
+        metrics_path: Path | None = None
+        if config.enable_metrics:
+            metrics = MetricsBufferAdapter()
+            metrics.start_drain()
+            metrics_path = Path(config.output_dir) / "metrics.parquet"
+
+        spans: SpanRecorder | None = None
+        if config.enable_span_timers:
+            spans = SpanRecorder(component="renderer", metrics=metrics)
+
+        borrowed_renderer = renderer is not None
+        if renderer is None:
+            renderer = self._build_renderer(
+                config=config, point_cloud_path=point_cloud_path, span_recorder=spans
+            )
+            renderer.initialize()
         point_count = renderer.loaded_point_count
         scene_radius = renderer.scene_radius
         backend_name = renderer.backend_name
@@ -147,6 +246,18 @@ class HeadlessAblationRunner:
         last_tc_rate_kbps: int | None = None
         tc_applied = False
 
+        # Trace-driven rates are known up front, so shaping runs on its own
+        # schedule thread and the render loop never blocks on tc. Only
+        # ABR-driven rates (no network trace) still use the inline path.
+        tc_shaper: AsyncTcShaper | None = None
+        if tc_manager is not None and config.network_trace_path and datagrams:
+            tc_shaper = AsyncTcShaper(
+                interface_name=config.tc_interface or "",
+                timestamps_ms=[d.timestamp_ms for d in datagrams],
+                rates_kbps=[d.target_bitrate_kbps for d in datagrams],
+            )
+            tc_manager = None
+
         render_times_ms: list[float] = []
         abr_target_kbps: list[int] = []
         abr_lod_choices: list[str] = []
@@ -156,6 +267,25 @@ class HeadlessAblationRunner:
         previous_timestamp_ms: float | None = None
         previous_render_ms = 0.0
 
+        frame_sink: _FrameSinkWorker | None = None
+        if config.pipeline_mode == "pipelined" and frame_callback is not None:
+            frame_sink = _FrameSinkWorker(frame_callback=frame_callback, renderer=renderer)
+
+        first_timestamp_ms = datagrams[0].timestamp_ms if datagrams else 0.0
+        held_frame = None
+        dropped_frames = 0
+        late_frames = 0
+        stall_time_ms_total = 0.0
+        max_lateness_ms = 0.0
+
+        if tc_shaper is not None:
+            try:
+                tc_shaper.start()
+                tc_status = "active_async"
+            except Exception as exc:  # pragma: no cover - host-permission dependent
+                tc_status = f"disabled:{type(exc).__name__}"
+                tc_shaper = None
+
         wall_start = time.perf_counter()
         try:
             for datagram in datagrams:
@@ -165,6 +295,37 @@ class HeadlessAblationRunner:
                     frame_interval_ms = max(1.0, datagram.timestamp_ms - previous_timestamp_ms)
                 previous_timestamp_ms = datagram.timestamp_ms
 
+                due_s = wall_start + (datagram.timestamp_ms - first_timestamp_ms) / 1000.0
+                if config.realtime_pacing:
+                    now_s = time.perf_counter()
+                    if now_s < due_s:
+                        time.sleep(due_s - now_s)
+                    elif (now_s - due_s) * 1000.0 > frame_interval_ms and held_frame is not None:
+                        # This slot's deadline passed before rendering could
+                        # start: drop it and present the previous frame again.
+                        dropped_frames += 1
+                        stall_time_ms_total += frame_interval_ms
+                        if metrics is not None:
+                            metrics.write_event(
+                                MetricEvent(
+                                    component="runner",
+                                    event_type="drop_frame",
+                                    timestamp_ns=MetricsBufferAdapter.now_ns(),
+                                    seq_id=datagram.seq_id,
+                                    value=(now_s - due_s) * 1000.0,
+                                )
+                            )
+                        if frame_callback is not None:
+                            frame_callback(
+                                held_frame.data,
+                                held_frame.width,
+                                held_frame.height,
+                                held_frame.frame_id,
+                                datagram,
+                                0.0,
+                            )
+                        continue
+
                 baseline_target_kbps = int(max(1, datagram.target_bitrate_kbps))
                 estimated_throughput_kbps = float(baseline_target_kbps)
                 if throughput_estimator is not None:
@@ -217,34 +378,91 @@ class HeadlessAblationRunner:
                 abr_target_kbps.append(chosen_target_kbps)
                 abr_lod_choices.append(chosen_lod)
 
-                if frame_callback is not None:
-                    frame_callback(
-                        frame.data,
-                        frame.width,
-                        frame.height,
-                        frame.frame_id,
-                        datagram,
-                        render_ms,
+                if config.realtime_pacing:
+                    lateness_ms = (time.perf_counter() - due_s) * 1000.0 - frame_interval_ms
+                    if lateness_ms > 0.0:
+                        late_frames += 1
+                        stall_time_ms_total += lateness_ms
+                        max_lateness_ms = max(max_lateness_ms, lateness_ms)
+
+                if metrics is not None:
+                    metrics.write_event(
+                        MetricEvent(
+                            component="renderer",
+                            event_type="render_frame",
+                            timestamp_ns=MetricsBufferAdapter.now_ns(),
+                            seq_id=datagram.seq_id,
+                            duration_us=render_ms * 1000.0,
+                            tags={"lod": chosen_lod},
+                        )
                     )
 
+                frame_nbytes = len(frame.data)
+                if frame_callback is not None and frame_sink is not None:
+                    frame_sink.submit(frame, datagram, render_ms)
+                else:
+                    if frame_callback is not None:
+                        sink_start = time.perf_counter()
+                        callback_span = spans.begin() if spans is not None else 0
+                        frame_callback(
+                            frame.data,
+                            frame.width,
+                            frame.height,
+                            frame.frame_id,
+                            datagram,
+                            render_ms,
+                        )
+                        if spans is not None:
+                            spans.end("frame_callback", callback_span)
+                        if metrics is not None:
+                            metrics.write_event(
+                                MetricEvent(
+                                    component="frame_sink",
+                                    event_type="deliver_frame",
+                                    timestamp_ns=MetricsBufferAdapter.now_ns(),
+                                    seq_id=datagram.seq_id,
+                                    duration_us=(time.perf_counter() - sink_start) * 1e6,
+                                )
+                            )
+                    if config.realtime_pacing:
+                        # Keep the newest frame alive so a late successor can
+                        # substitute it; recycle the one it replaces.
+                        if held_frame is not None:
+                            renderer.recycle(held_frame)
+                        held_frame = frame
+                    else:
+                        renderer.recycle(frame)
+
                 if throughput_estimator is not None:
                     measured = throughput_estimator.observe(
-                        delivered_bytes=len(frame.data),
+                        delivered_bytes=frame_nbytes,
                         elapsed_s=frame_interval_ms / 1000.0,
                     )
                     measured_throughput_kbps.append(measured)
-                    frame_bits = float(len(frame.data) * 8)
+                    frame_bits = float(frame_nbytes * 8)
                     download_time_ms = frame_bits / max(1.0, float(chosen_target_kbps))
                     buffer_level_ms = float(
                         np.clip(buffer_level_ms + frame_interval_ms - download_time_ms, 0.0, max_buffer_ms)
                     )
         finally:
+            if held_frame is not None:
+                renderer.recycle(held_frame)
+            if frame_sink is not None:
+                frame_sink.close()
+            metric_event_count = 0
+            if metrics is not None and metrics_path is not None:
+                metric_event_count = metrics.drain_to_parquet(str(metrics_path))
+            if tc_shaper is not None:
+                tc_shaper.stop()
+                if tc_shaper.status not in ("stopped", "active"):
+                    tc_status = tc_shaper.status
             if tc_manager is not None and tc_applied and config.tc_interface:
                 try:
                     tc_manager.clear(config.tc_interface)
                 except Exception as exc:  # pragma: no cover - host-permission dependent
                     tc_status = f"clear_failed:{type(exc).__name__}"
-            renderer.shutdown()
+            if not borrowed_renderer:
+                renderer.shutdown()
 
         wall_time_s = time.perf_counter() - wall_start
         frames_rendered = len(render_times_ms)
@@ -267,6 +485,14 @@ class HeadlessAblationRunner:
             "frames_rendered": frames_rendered,
             "resolution": {"width": config.width, "height": config.height},
             "renderer_backend": backend_name,
+            "pipeline_mode": config.pipeline_mode,
+            "pacing": {
+                "mode": "realtime" if config.realtime_pacing else "unpaced",
+                "dropped_frames": dropped_frames,
+                "late_frames": late_frames,
+                "stall_time_ms_total": stall_time_ms_total,
+                "max_lateness_ms": max_lateness_ms,
+            },
             "point_count": point_count,
             "scene_radius": scene_radius,
             "abr_profile": abr_profile_name,
@@ -279,7 +505,20 @@ class HeadlessAblationRunner:
                 "enabled": bool(config.enable_tc and config.tc_interface),
                 "interface": config.tc_interface,
                 "status": tc_status,
+                "schedule": {
+                    "steps_total": tc_shaper.steps_total,
+                    "steps_applied": tc_shaper.steps_applied,
+                }
+                if tc_shaper is not None
+                else None,
+            },
+            "metrics": {
+                "enabled": bool(config.enable_metrics),
+                "path": str(metrics_path) if metrics_path is not None else None,
+                "events": metric_event_count,
+                "dropped": metrics.dropped_events if metrics is not None else 0,
             },
+            "stage_timings": spans.summarize() if spans is not None else {},
             "render_time_ms": {
                 "mean": float(statistics.fmean(render_times_ms)),
                 "median": float(statistics.median(render_times_ms)),
@@ -0,0 +1,420 @@
+"""Distributed work-queue execution for evaluation sweeps.
+
+A coordinator expands an `ExperimentConfig` matrix into a job queue and
+serves it over TCP JSON lines; workers on the render pool pull configs
+matching their backend capabilities, execute `EvaluationRunner.run_one`,
+and push summary JSON back. Jobs carry capability tags so `gsplat_cuda`
+configs only land on CUDA hosts, and leases let the coordinator re-dispatch
+stragglers whose worker died or stalled.
+
+Protocol (one JSON object per line, worker-initiated):
+
+    worker -> {"type": "request_job", "capabilities": ["cpu", "cuda"]}
+    coord  -> {"type": "job", "job_id": 3, "config": {...}} |
+              {"type": "idle"} | {"type": "done"}
+    worker -> {"type": "result", "job_id": 3, "status": "ok",
+               "summary": {...}}  (or "status": "error", "error": "...")
+    coord  -> {"type": "ack"}
+
+Artifacts stay on the executing host under the worker's output root; the
+summary pushed back carries their paths, which is how the nightly scripts
+already consume single-host runs.
+"""
+
+from __future__ import annotations
+
+import argparse
+import itertools
+import json
+import socket
+import socketserver
+import threading
+import time
+from dataclasses import asdict, dataclass, fields
+from pathlib import Path
+
+from tigas.shared.types import ExperimentConfig
+
+_CONFIG_FIELD_NAMES = {field.name for field in fields(ExperimentConfig)}
+
+
+def expand_config_matrix(matrix: dict) -> list[ExperimentConfig]:
+    """Expand a field->value(s) mapping into the cross product of configs.
+
+    List values are swept; scalars are held fixed. Field names must match
+    `ExperimentConfig` exactly so typos fail loudly before dispatch.
+    """
+    unknown = set(matrix) - _CONFIG_FIELD_NAMES
+    if unknown:
+        raise ValueError(f"Unknown config fields in matrix: {sorted(unknown)}")
+
+    sweep_keys = [key for key, value in matrix.items() if isinstance(value, list)]
+    fixed = {key: value for key, value in matrix.items() if not isinstance(value, list)}
+    if not sweep_keys:
+        return [ExperimentConfig(**fixed)]
+
+    configs: list[ExperimentConfig] = []
+    for combination in itertools.product(*(matrix[key] for key in sweep_keys)):
+        payload = dict(fixed)
+        payload.update(zip(sweep_keys, combination))
+        configs.append(ExperimentConfig(**payload))
+    return configs
+
+
+def required_capabilities(config: ExperimentConfig) -> set[str]:
+    """Capability tags a worker must advertise to execute `config`."""
+    required = {"cpu"}
+    if config.renderer_backend == "gsplat_cuda":
+        required.add("cuda")
+    if config.codec in ("h264_nvenc", "av1_nvenc"):
+        required.add("nvenc")
+    return required
+
+
+def detect_capabilities() -> set[str]:
+    """Advertise this host's capabilities; CUDA detection is best-effort."""
+    capabilities = {"cpu"}
+    try:
+        import torch
+
+        if torch.cuda.is_available():
+            capabilities.update({"cuda", "nvenc"})
+    except ImportError:
+        pass
+    return capabilities
+
+
+@dataclass(slots=True)
+class _Job:
+    job_id: int
+    config_payload: dict
+    required: set[str]
+    attempts: int = 0
+    state: str = "pending"  # pending | leased | done | failed
+    lease_deadline: float = 0.0
+    error: str | None = None
+
+
+class WorkQueue:
+    """Thread-safe job queue with capability matching and lease re-dispatch.
+
+    A claimed job holds a lease; if the worker neither completes nor fails
+    it before the lease expires, the job silently returns to the pending
+    pool on the next claim, which is what bounds straggler impact. Failed
+    jobs are retried up to `max_attempts` before being marked failed.
+    """
+
+    def __init__(
+        self,
+        configs: list[ExperimentConfig],
+        max_attempts: int = 3,
+        lease_timeout_s: float = 600.0,
+    ) -> None:
+        if not configs:
+            raise ValueError("Work queue requires at least one config.")
+        if max_attempts < 1:
+            raise ValueError("max_attempts must be at least 1.")
+        self.max_attempts = int(max_attempts)
+        self.lease_timeout_s = float(lease_timeout_s)
+        self._jobs = [
+            _Job(job_id=index, config_payload=asdict(config), required=required_capabilities(config))
+            for index, config in enumerate(configs)
+        ]
+        self._lock = threading.Lock()
+        self._all_done = threading.Event()
+        self.summaries: dict[int, dict] = {}
+
+    def _reclaim_expired_locked(self, now_s: float) -> None:
+        for job in self._jobs:
+            if job.state == "leased" and now_s > job.lease_deadline:
+                job.state = "pending"
+
+    def claim(self, capabilities: set[str]) -> _Job | None:
+        """Lease the next pending job this worker can run, or None."""
+        now_s = time.monotonic()
+        with self._lock:
+            self._reclaim_expired_locked(now_s)
+            for job in self._jobs:
+                if job.state == "pending" and job.required <= capabilities:
+                    job.state = "leased"
+                    job.attempts += 1
+                    job.lease_deadline = now_s + self.lease_timeout_s
+                    return job
+        return None
+
+    def complete(self, job_id: int, summary: dict) -> None:
+        with self._lock:
+            job = self._jobs[job_id]
+            if job.state == "done":
+                return  # duplicate result from a re-dispatched straggler
+            job.state = "done"
+            self.summaries[job_id] = summary
+            self._check_done_locked()
+
+    def fail(self, job_id: int, error: str) -> None:
+        with self._lock:
+            job = self._jobs[job_id]
+            if job.state == "done":
+                return
+            job.error = error
+            if job.attempts >= self.max_attempts:
+                job.state = "failed"
+            else:
+                job.state = "pending"
+            self._check_done_locked()
+
+    def _check_done_locked(self) -> None:
+        if all(job.state in ("done", "failed") for job in self._jobs):
+            self._all_done.set()
+
+    def all_done(self) -> bool:
+        return self._all_done.is_set()
+
+    def wait(self, timeout_s: float | None = None) -> bool:
+        return self._all_done.wait(timeout=timeout_s)
+
+    def stats(self) -> dict:
+        with self._lock:
+            states = [job.state for job in self._jobs]
+            return {
+                "total": len(states),
+                "pending": states.count("pending"),
+                "leased": states.count("leased"),
+                "done": states.count("done"),
+                "failed": states.count("failed"),
+            }
+
+    def failed_jobs(self) -> list[dict]:
+        with self._lock:
+            return [
+                {"job_id": job.job_id, "attempts": job.attempts, "error": job.error}
+                for job in self._jobs
+                if job.state == "failed"
+            ]
+
+
+class _CoordinatorHandler(socketserver.StreamRequestHandler):
+    """One persistent JSON-lines connection per worker."""
+
+    def _respond(self, payload: dict) -> None:
+        self.wfile.write((json.dumps(payload) + "\n").encode("utf-8"))
+
+    def handle(self) -> None:
+        queue: WorkQueue = self.server.queue  # type: ignore[attr-defined]
+        for raw_line in self.rfile:
+            line = raw_line.decode("utf-8").strip()
+            if not line:
+                continue
+            try:
+                message = json.loads(line)
+            except json.JSONDecodeError as exc:
+                self._respond({"type": "error", "error": f"JSONDecodeError: {exc}"})
+                continue
+
+            message_type = message.get("type")
+            if message_type == "request_job":
+                if queue.all_done():
+                    self._respond({"type": "done"})
+                    continue
+                job = queue.claim(set(message.get("capabilities", ["cpu"])))
+                if job is None:
+                    self._respond({"type": "idle"})
+                else:
+                    self._respond(
+                        {"type": "job", "job_id": job.job_id, "config": job.config_payload}
+                    )
+            elif message_type == "result":
+                job_id = int(message["job_id"])
+                if message.get("status") == "ok":
+                    queue.complete(job_id, message.get("summary", {}))
+                else:
+                    queue.fail(job_id, str(message.get("error", "unknown worker error")))
+                self._respond({"type": "ack"})
+            else:
+                self._respond({"type": "error", "error": f"Unknown message type '{message_type}'."})
+
+
+class SweepCoordinator:
+    """Serves an expanded config matrix to workers and collects summaries."""
+
+    def __init__(
+        self,
+        configs: list[ExperimentConfig],
+        host: str = "0.0.0.0",
+        port: int = 7621,
+        max_attempts: int = 3,
+        lease_timeout_s: float = 600.0,
+    ) -> None:
+        self.queue = WorkQueue(configs, max_attempts=max_attempts, lease_timeout_s=lease_timeout_s)
+        self._server = socketserver.ThreadingTCPServer((host, port), _CoordinatorHandler, bind_and_activate=False)
+        self._server.allow_reuse_address = True
+        self._server.daemon_threads = True
+        self._server.queue = self.queue  # type: ignore[attr-defined]
+        self._server.server_bind()
+        self._server.server_activate()
+        self._server_thread: threading.Thread | None = None
+
+    @property
+    def address(self) -> tuple[str, int]:
+        return self._server.server_address  # type: ignore[return-value]
+
+    def start(self) -> None:
+        self._server_thread = threading.Thread(
+            target=self._server.serve_forever, name="tigas-sweep-coordinator", daemon=True
+        )
+        self._server_thread.start()
+
+    def run_until_complete(self, results_path: str | None = None) -> dict:
+        """Block until every job is done or failed; optionally write results.
+
+        Workers polling after completion receive `done` responses until the
+        caller shuts the coordinator down, so slow pollers exit cleanly.
+        """
+        self.queue.wait()
+        report = {
+            "stats": self.queue.stats(),
+            "failed": self.queue.failed_jobs(),
+            "summaries": [self.queue.summaries[key] for key in sorted(self.queue.summaries)],
+        }
+        if results_path is not None:
+            output = Path(results_path)
+            output.parent.mkdir(parents=True, exist_ok=True)
+            with output.open("w", encoding="utf-8") as handle:
+                for summary in report["summaries"]:
+                    handle.write(json.dumps(summary) + "\n")
+        return report
+
+    def shutdown(self) -> None:
+        self._server.shutdown()
+        self._server.server_close()
+        if self._server_thread is not None:
+            self._server_thread.join(timeout=2.0)
+            self._server_thread = None
+
+
+class SweepWorker:
+    """Pulls configs from a coordinator and executes evaluation runs."""
+
+    def __init__(
+        self,
+        host: str,
+        port: int,
+        output_root: str,
+        capabilities: set[str] | None = None,
+        poll_interval_s: float = 2.0,
+    ) -> None:
+        self.host = host
+        self.port = int(port)
+        self.output_root = output_root
+        self.capabilities = capabilities if capabilities is not None else detect_capabilities()
+        self.poll_interval_s = float(poll_interval_s)
+        self.jobs_completed = 0
+        self.jobs_failed = 0
+
+    def _execute(self, config_payload: dict) -> dict:
+        # Imported here so coordinator-only hosts need no evaluation deps.
+        from tigas.evaluation.evaluator import EvaluationRunner
+
+        config = ExperimentConfig(**config_payload)
+        result = EvaluationRunner().run_one(config=config, output_root=self.output_root)
+        return result.summary
+
+    def run(self) -> None:
+        """Work the queue until the coordinator reports completion."""
+        with socket.create_connection((self.host, self.port)) as connection:
+            reader = connection.makefile("r", encoding="utf-8")
+            writer = connection.makefile("w", encoding="utf-8")
+
+            def exchange(message: dict) -> dict:
+                writer.write(json.dumps(message) + "\n")
+                writer.flush()
+                line = reader.readline()
+                if not line:
+                    raise RuntimeError("Coordinator closed the connection.")
+                return json.loads(line)
+
+            while True:
+                response = exchange(
+                    {"type": "request_job", "capabilities": sorted(self.capabilities)}
+                )
+                if response["type"] == "done":
+                    return
+                if response["type"] == "idle":
+                    time.sleep(self.poll_interval_s)
+                    continue
+
+                job_id = response["job_id"]
+                try:
+                    summary = self._execute(response["config"])
+                except Exception as exc:  # noqa: BLE001 - reported for re-dispatch
+                    self.jobs_failed += 1
+                    exchange(
+                        {
+                            "type": "result",
+                            "job_id": job_id,
+                            "status": "error",
+                            "error": f"{type(exc).__name__}: {exc}",
+                        }
+                    )
+                else:
+                    self.jobs_completed += 1
+                    exchange(
+                        {"type": "result", "job_id": job_id, "status": "ok", "summary": summary}
+                    )
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Distributed TIGAS evaluation sweep")
+    parser.add_argument("role", choices=["coordinator", "worker"])
+    parser.add_argument("--host", default="0.0.0.0", help="Bind/connect address")
+    parser.add_argument("--port", type=int, default=7621, help="Coordinator TCP port")
+    parser.add_argument(
+        "--matrix",
+        default="",
+        help="Coordinator: JSON file mapping ExperimentConfig fields to values or value lists",
+    )
+    parser.add_argument(
+        "--results",
+        default="",
+        help="Coordinator: write collected summaries to this JSON-lines file",
+    )
+    parser.add_argument(
+        "--output-root",
+        default="outputs/distributed",
+        help="Worker: local root for run artifacts",
+    )
+    parser.add_argument(
+        "--max-attempts", type=int, default=3, help="Coordinator: retries per job before failing it"
+    )
+    parser.add_argument(
+        "--lease-timeout-s",
+        type=float,
+        default=600.0,
+        help="Coordinator: seconds before a claimed job is re-dispatched",
+    )
+    args = parser.parse_args()
+
+    if args.role == "coordinator":
+        if not args.matrix:
+            parser.error("--matrix is required for the coordinator role")
+        with open(args.matrix, "r", encoding="utf-8") as handle:
+            matrix = json.load(handle)
+        coordinator = SweepCoordinator(
+            expand_config_matrix(matrix),
+            host=args.host,
+            port=args.port,
+            max_attempts=args.max_attempts,
+            lease_timeout_s=args.lease_timeout_s,
+        )
+        coordinator.start()
+        try:
+            report = coordinator.run_until_complete(results_path=args.results or None)
+        finally:
+            coordinator.shutdown()
+        print(json.dumps({"stats": report["stats"], "failed": report["failed"]}, indent=2))
+    else:
+        SweepWorker(host=args.host, port=args.port, output_root=args.output_root).run()
+
+
+if __name__ == "__main__":
+    main()
@@ -1,28 +1,361 @@
-"""Pipeline orchestration placeholder.
+"""Pipeline orchestration.
 
-Intended responsibilities:
+`TigasPipeline` wires the six runtime stages — uplink → predictor → renderer
+→ encoder → packager → transport — as asyncio tasks connected by bounded
+queues, so a slow stage back-pressures its producer instead of growing
+memory. The pose input is a small latest-wins buffer: stale poses are shed,
+never queued, which keeps motion-to-photon latency flat when the renderer or
+encoder falls behind.
 
-1. Create module instances from runtime configuration.
-2. Wire dataflow between input, intelligence, rendering, coding, and transport.
-3. Emit lifecycle and metrics events for observability.
+Concrete components come from `registry.build_default_registry()` based on
+`RuntimeConfig` names. `start`/`stop` run the pipeline on a background event
+loop (matching the `LifecycleComponent` contract); `step` executes one fully
+synchronous tick through all stages for deterministic testing. Per-stage
+queue-depth and latency gauges are exposed via `gauges()`.
 """
 
 from __future__ import annotations
 
+import asyncio
+import statistics
+import threading
+import time
+from collections import deque
+from typing import Callable
+
+from tigas.media.cmaf_packager import BasicCmafPackager
+from tigas.orchestration.registry import ComponentRegistry, build_default_registry
 from tigas.shared.config import RuntimeConfig
+from tigas.shared.types import (
+    CmafFragment,
+    EncodingPolicy,
+    RenderRequest,
+    UplinkDatagram,
+)
+
+FragmentSink = Callable[[CmafFragment], None]
+
+_STAGE_NAMES = ("uplink", "predictor", "renderer", "encoder", "packager", "transport")
+
+
+class _StageGauge:
+    """Rolling latency and throughput gauge for one pipeline stage."""
+
+    __slots__ = ("processed", "latencies_ms")
+
+    def __init__(self) -> None:
+        self.processed = 0
+        self.latencies_ms: deque[float] = deque(maxlen=256)
+
+    def record(self, latency_ms: float) -> None:
+        self.processed += 1
+        self.latencies_ms.append(latency_ms)
+
+    def snapshot(self, queue_depth: int) -> dict:
+        latencies = list(self.latencies_ms)
+        return {
+            "queue_depth": queue_depth,
+            "processed": self.processed,
+            "mean_latency_ms": float(statistics.fmean(latencies)) if latencies else 0.0,
+            "max_latency_ms": float(max(latencies)) if latencies else 0.0,
+        }
 
 
 class TigasPipeline:
-    """Placeholder orchestrator for interactive and replay execution."""
+    """Bounded-queue asyncio orchestrator for interactive and replay execution."""
 
-    def __init__(self, config: RuntimeConfig) -> None:
+    def __init__(
+        self,
+        config: RuntimeConfig,
+        uplink=None,
+        fragment_sink: FragmentSink | None = None,
+        registry: ComponentRegistry | None = None,
+        rtt_ms: float = 50.0,
+        pose_buffer_depth: int = 8,
+    ) -> None:
         self.config = config
+        self._registry = registry or build_default_registry()
+        self._uplink = uplink
+        self._fragment_sink = fragment_sink
+        self._rtt_ms = float(rtt_ms)
+        self.recent_fragments: deque[CmafFragment] = deque(maxlen=64)
+
+        self._predictor = self._build("predictors", config.predictor.name)()
+        self._renderer = self._build("renderers", config.render.backend)(
+            point_cloud_path=config.render.point_cloud_path or None,
+            width=config.render.width,
+            height=config.render.height,
+            max_points=config.render.max_points,
+        )
+        self._encoder = self._build("encoders", config.encoder.codec)(
+            fps=config.render.target_fps
+        )
+        self._packager = BasicCmafPackager()
+
+        self._pose_buffer: deque[UplinkDatagram] = deque(maxlen=max(1, pose_buffer_depth))
+        self.coalesced_poses = 0
+        self._gauges = {name: _StageGauge() for name in _STAGE_NAMES}
+        self._queues: dict[str, asyncio.Queue] = {}
+        self._frame_count = 0
+        self._initialized = False
+        self._started = False
+        self._stop_event: asyncio.Event | None = None
+        self._loop: asyncio.AbstractEventLoop | None = None
+        self._thread: threading.Thread | None = None
+        self._error: BaseException | None = None
+        self._idle_sleep_s = 0.5 / max(1, config.render.target_fps)
+
+    def _build(self, table: str, name: str):
+        factory = getattr(self._registry, table).get(name)
+        if factory is None:
+            known = ", ".join(sorted(getattr(self._registry, table)))
+            raise ValueError(f"Unknown {table[:-1]} '{name}'. Known: {known}.")
+        return factory
+
+    def _ensure_initialized(self) -> None:
+        if not self._initialized:
+            self._renderer.initialize()
+            self._initialized = True
+
+    def _policy_for(self, datagram: UplinkDatagram) -> EncodingPolicy:
+        return EncodingPolicy(
+            codec=self.config.encoder.codec,
+            target_bitrate_kbps=min(
+                max(1, datagram.target_bitrate_kbps),
+                max(1, self.config.encoder.target_bitrate_kbps),
+            ),
+            gop_size=self.config.encoder.gop_size,
+        )
+
+    def submit_pose(self, datagram: UplinkDatagram) -> None:
+        """Feed one pose update; the bounded buffer sheds the oldest entry."""
+        self._pose_buffer.append(datagram)
+
+    def _take_newest_pose(self) -> UplinkDatagram | None:
+        """Drain the pose buffer, latest-wins by sequence id."""
+        if not self._pose_buffer:
+            return None
+        newest: UplinkDatagram | None = None
+        drained = 0
+        while self._pose_buffer:
+            try:
+                candidate = self._pose_buffer.popleft()
+            except IndexError:  # pragma: no cover - concurrent producer
+                break
+            drained += 1
+            if newest is None or candidate.seq_id >= newest.seq_id:
+                newest = candidate
+        if drained > 1:
+            self.coalesced_poses += drained - 1
+        return newest
+
+    # ------------------------------------------------------------------
+    # Synchronous one-tick path for deterministic testing.
+    # ------------------------------------------------------------------
+
+    def step(self, datagram: UplinkDatagram | None = None) -> CmafFragment | None:
+        """Run one pose through every stage inline and return the fragment."""
+        self._ensure_initialized()
+        if datagram is None:
+            datagram = self._take_newest_pose()
+        if datagram is None:
+            return None
+        self._gauges["uplink"].record(0.0)
+
+        stage_start = time.perf_counter()
+        prediction = self._predictor.predict(datagram, rtt_ms=self._rtt_ms)
+        self._gauges["predictor"].record((time.perf_counter() - stage_start) * 1000.0)
+
+        request = RenderRequest(
+            pose_matrix_4x4=prediction.predicted_matrix_4x4,
+            lod_id=(
+                datagram.requested_lod
+                if self.config.render.default_lod == "adaptive"
+                else self.config.render.default_lod
+            ),
+            time_offset_ms=datagram.timestamp_ms,
+        )
+        stage_start = time.perf_counter()
+        frame = self._renderer.render(request)
+        frame.is_keyframe_hint = self._frame_count % max(1, self.config.encoder.gop_size) == 0
+        self._frame_count += 1
+        self._gauges["renderer"].record((time.perf_counter() - stage_start) * 1000.0)
+
+        stage_start = time.perf_counter()
+        encoded = self._encoder.encode(frame, self._policy_for(datagram))
+        self._renderer.recycle(frame)
+        self._gauges["encoder"].record((time.perf_counter() - stage_start) * 1000.0)
+
+        stage_start = time.perf_counter()
+        fragment = self._packager.package(encoded, frame)
+        self._gauges["packager"].record((time.perf_counter() - stage_start) * 1000.0)
+
+        stage_start = time.perf_counter()
+        if self._fragment_sink is not None:
+            self._fragment_sink(fragment)
+        self.recent_fragments.append(fragment)
+        self._gauges["transport"].record((time.perf_counter() - stage_start) * 1000.0)
+        return fragment
+
+    # ------------------------------------------------------------------
+    # Asyncio stage tasks.
+    # ------------------------------------------------------------------
+
+    async def _uplink_stage(self) -> None:
+        while True:
+            drained = self._uplink.receive_many() if self._uplink is not None else []
+            for datagram in drained:
+                self.submit_pose(datagram)
+                self._gauges["uplink"].record(0.0)
+            await asyncio.sleep(self._idle_sleep_s)
+
+    async def _predictor_stage(self) -> None:
+        out_queue = self._queues["renderer"]
+        while True:
+            datagram = self._take_newest_pose()
+            if datagram is None:
+                await asyncio.sleep(self._idle_sleep_s)
+                continue
+            stage_start = time.perf_counter()
+            prediction = self._predictor.predict(datagram, rtt_ms=self._rtt_ms)
+            request = RenderRequest(
+                pose_matrix_4x4=prediction.predicted_matrix_4x4,
+                lod_id=(
+                    datagram.requested_lod
+                    if self.config.render.default_lod == "adaptive"
+                    else self.config.render.default_lod
+                ),
+                time_offset_ms=datagram.timestamp_ms,
+            )
+            self._gauges["predictor"].record((time.perf_counter() - stage_start) * 1000.0)
+            await out_queue.put((datagram, request))
+
+    async def _renderer_stage(self) -> None:
+        loop = asyncio.get_running_loop()
+        in_queue = self._queues["renderer"]
+        out_queue = self._queues["encoder"]
+        while True:
+            datagram, request = await in_queue.get()
+            stage_start = time.perf_counter()
+            frame = await loop.run_in_executor(None, self._renderer.render, request)
+            frame.is_keyframe_hint = (
+                self._frame_count % max(1, self.config.encoder.gop_size) == 0
+            )
+            self._frame_count += 1
+            self._gauges["renderer"].record((time.perf_counter() - stage_start) * 1000.0)
+            await out_queue.put((datagram, frame))
+
+    async def _encoder_stage(self) -> None:
+        loop = asyncio.get_running_loop()
+        in_queue = self._queues["encoder"]
+        out_queue = self._queues["packager"]
+        while True:
+            datagram, frame = await in_queue.get()
+            stage_start = time.perf_counter()
+            encoded = await loop.run_in_executor(
+                None, self._encoder.encode, frame, self._policy_for(datagram)
+            )
+            self._renderer.recycle(frame)
+            self._gauges["encoder"].record((time.perf_counter() - stage_start) * 1000.0)
+            await out_queue.put((frame, encoded))
+
+    async def _packager_stage(self) -> None:
+        in_queue = self._queues["packager"]
+        out_queue = self._queues["transport"]
+        while True:
+            frame, encoded = await in_queue.get()
+            stage_start = time.perf_counter()
+            fragment = self._packager.package(encoded, frame)
+            self._gauges["packager"].record((time.perf_counter() - stage_start) * 1000.0)
+            await out_queue.put(fragment)
+
+    async def _transport_stage(self) -> None:
+        in_queue = self._queues["transport"]
+        while True:
+            fragment = await in_queue.get()
+            stage_start = time.perf_counter()
+            if self._fragment_sink is not None:
+                self._fragment_sink(fragment)
+            self.recent_fragments.append(fragment)
+            self._gauges["transport"].record((time.perf_counter() - stage_start) * 1000.0)
+
+    async def _run_async(self) -> None:
+        self._stop_event = asyncio.Event()
+        self._queues = {
+            "renderer": asyncio.Queue(maxsize=1),
+            "encoder": asyncio.Queue(maxsize=2),
+            "packager": asyncio.Queue(maxsize=4),
+            "transport": asyncio.Queue(maxsize=8),
+        }
+        tasks = [
+            asyncio.create_task(self._uplink_stage(), name="tigas-uplink"),
+            asyncio.create_task(self._predictor_stage(), name="tigas-predictor"),
+            asyncio.create_task(self._renderer_stage(), name="tigas-renderer"),
+            asyncio.create_task(self._encoder_stage(), name="tigas-encoder"),
+            asyncio.create_task(self._packager_stage(), name="tigas-packager"),
+            asyncio.create_task(self._transport_stage(), name="tigas-transport"),
+        ]
+        try:
+            stop_wait = asyncio.create_task(self._stop_event.wait())
+            done, _ = await asyncio.wait(
+                [stop_wait, *tasks], return_when=asyncio.FIRST_COMPLETED
+            )
+            for task in done:
+                if task is not stop_wait and task.exception() is not None:
+                    self._error = task.exception()
+        finally:
+            for task in tasks:
+                task.cancel()
+            await asyncio.gather(*tasks, return_exceptions=True)
 
     def start(self) -> None:
-        raise NotImplementedError("Implement startup sequence and component wiring.")
+        """Initialize components and run the stage tasks on a background loop."""
+        if self._started:
+            raise RuntimeError("Pipeline is already started.")
+        self._ensure_initialized()
+        self._started = True
 
-    def step(self) -> None:
-        raise NotImplementedError("Implement one pipeline tick for deterministic testing.")
+        def _run() -> None:
+            self._loop = asyncio.new_event_loop()
+            try:
+                self._loop.run_until_complete(self._run_async())
+            finally:
+                self._loop.close()
+                self._loop = None
+
+        self._thread = threading.Thread(target=_run, name="tigas-pipeline", daemon=True)
+        self._thread.start()
 
     def stop(self) -> None:
-        raise NotImplementedError("Implement orderly shutdown and metrics flush.")
+        """Stop stage tasks, flush the encoder, and shut the renderer down."""
+        if self._started and self._thread is not None:
+            loop = self._loop
+            if loop is not None and self._stop_event is not None:
+                loop.call_soon_threadsafe(self._stop_event.set)
+            self._thread.join()
+            self._thread = None
+            self._started = False
+
+        if hasattr(self._encoder, "close"):
+            self._encoder.close()
+        if self._initialized:
+            self._renderer.shutdown()
+            self._initialized = False
+        if self._error is not None:
+            error = self._error
+            self._error = None
+            raise RuntimeError("Pipeline stage failed.") from error
+
+    def healthcheck(self) -> bool:
+        """Return True while no stage has failed."""
+        return self._error is None
+
+    def gauges(self) -> dict:
+        """Snapshot per-stage queue depth, throughput, and latency."""
+        depths = {name: 0 for name in _STAGE_NAMES}
+        depths["uplink"] = len(self._pose_buffer)
+        for name, queue in self._queues.items():
+            depths[name] = queue.qsize()
+        return {
+            name: self._gauges[name].snapshot(depths[name]) for name in _STAGE_NAMES
+        }
@@ -1,4 +1,4 @@
-"""Component registry placeholder.
+"""Component registry.
 
 Maps configuration names to concrete implementations for predictors, renderers,
 encoders, and transports while preserving explicit interface boundaries.
@@ -20,8 +20,35 @@ class ComponentRegistry:
 
 
 def build_default_registry() -> ComponentRegistry:
-    """Build registry with placeholder factory entries.
-
-    Concrete factories will be wired as module implementations are completed.
-    """
-    return ComponentRegistry(predictors={}, renderers={}, encoders={}, transports={})
+    """Build registry mapping config names to the concrete implementations."""
+    from tigas.intelligence.predictor_kalman import KalmanPosePredictor
+    from tigas.intelligence.predictor_noop import NoOpPosePredictor
+    from tigas.media.encoder_av1_nvenc import Av1NvencEncoder
+    from tigas.media.encoder_h264_nvenc import H264NvencEncoder
+    from tigas.media.encoder_libx264 import Libx264Encoder
+    from tigas.media.encoder_videotoolbox import VideoToolboxEncoder
+    from tigas.renderer.backend_cpu import CpuFallbackBackend
+    from tigas.renderer.backend_gsplat import GsplatCudaBackend
+    from tigas.transport.moq_publisher import MoqObjectPublisher
+    from tigas.transport.quic_uplink import QuicUplinkEndpoint
+
+    return ComponentRegistry(
+        predictors={
+            "noop": NoOpPosePredictor,
+            "kalman": KalmanPosePredictor,
+        },
+        renderers={
+            "cpu": CpuFallbackBackend,
+            "gsplat_cuda": GsplatCudaBackend,
+        },
+        encoders={
+            "libx264": Libx264Encoder,
+            "h264_nvenc": H264NvencEncoder,
+            "av1_nvenc": Av1NvencEncoder,
+            "videotoolbox_h264": VideoToolboxEncoder,
+        },
+        transports={
+            "quic_uplink": QuicUplinkEndpoint,
+            "moq_publisher": MoqObjectPublisher,
+        },
+    )
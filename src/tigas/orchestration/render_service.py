@@ -0,0 +1,180 @@
+"""Persistent render service with warm scene reuse.
+
+Nightly sweeps invoke `run_headless` hundreds of times, and each invocation
+pays interpreter startup plus full PLY decode. The service keeps one
+long-lived process that caches initialized renderer backends in an LRU keyed
+by scene identity and answers run requests over stdin or a local Unix socket
+as JSON lines — one `ExperimentConfig`-shaped object per request, one
+summary dict per response.
+"""
+
+from __future__ import annotations
+
+import json
+import socket
+import sys
+from collections import OrderedDict
+from dataclasses import fields
+from pathlib import Path
+from typing import Callable, TextIO
+
+from tigas.orchestration.ablation_runner import HeadlessAblationRunner
+from tigas.shared.types import ExperimentConfig
+
+_CONFIG_FIELD_NAMES = {field.name for field in fields(ExperimentConfig)}
+
+
+class RendererCache:
+    """LRU cache of initialized renderer backends keyed by scene identity.
+
+    The key covers every constructor input that shapes the decoded scene or
+    raster configuration, so a hit is always safe to reuse as-is. Evicted
+    renderers are shut down to release their decoded arrays.
+    """
+
+    def __init__(self, capacity: int = 4) -> None:
+        if capacity < 1:
+            raise ValueError("Renderer cache capacity must be at least 1.")
+        self.capacity = int(capacity)
+        self._entries: OrderedDict[tuple, object] = OrderedDict()
+        self.hits = 0
+        self.misses = 0
+        self.evictions = 0
+
+    @staticmethod
+    def key_for(config: ExperimentConfig, point_cloud_path: Path) -> tuple:
+        return (
+            config.renderer_backend,
+            str(point_cloud_path),
+            config.width,
+            config.height,
+            config.max_points,
+            config.quant_bits,
+            config.cpu_raster_engine,
+            config.gpu_async_readback,
+        )
+
+    def get_or_create(
+        self,
+        config: ExperimentConfig,
+        point_cloud_path: Path,
+        builder: Callable[[ExperimentConfig, Path], object],
+    ):
+        key = self.key_for(config, point_cloud_path)
+        renderer = self._entries.get(key)
+        if renderer is not None:
+            self._entries.move_to_end(key)
+            self.hits += 1
+            return renderer
+
+        self.misses += 1
+        renderer = builder(config, point_cloud_path)
+        renderer.initialize()
+        while len(self._entries) >= self.capacity:
+            _, evicted = self._entries.popitem(last=False)
+            evicted.shutdown()
+            self.evictions += 1
+        self._entries[key] = renderer
+        return renderer
+
+    def clear(self) -> None:
+        """Shut down and drop every cached renderer."""
+        while self._entries:
+            _, renderer = self._entries.popitem(last=False)
+            renderer.shutdown()
+
+
+class RenderService:
+    """Long-lived `run_one` server amortizing scene decode across runs."""
+
+    def __init__(self, cache_capacity: int = 4) -> None:
+        self._runner = HeadlessAblationRunner()
+        self._cache = RendererCache(capacity=cache_capacity)
+
+    @staticmethod
+    def _config_from_payload(payload: dict) -> ExperimentConfig:
+        unknown = set(payload) - _CONFIG_FIELD_NAMES
+        if unknown:
+            raise ValueError(f"Unknown config fields: {sorted(unknown)}")
+        return ExperimentConfig(**payload)
+
+    def run_request(self, payload: dict) -> dict:
+        """Execute one run request and return its summary (never raises)."""
+        try:
+            config = self._config_from_payload(payload)
+            point_cloud_path = self._runner._resolve_point_cloud_path(config)
+            renderer = self._cache.get_or_create(
+                config,
+                point_cloud_path,
+                lambda cfg, path: self._runner._build_renderer(config=cfg, point_cloud_path=path),
+            )
+            summary = self._runner.run_one(config, renderer=renderer)
+        except Exception as exc:  # noqa: BLE001 - reported to the client, service stays up
+            return {"status": "error", "error": f"{type(exc).__name__}: {exc}"}
+
+        summary["renderer_cache"] = {
+            "hits": self._cache.hits,
+            "misses": self._cache.misses,
+            "evictions": self._cache.evictions,
+        }
+        return summary
+
+    def _serve_lines(self, input_stream, output_stream) -> bool:
+        """Answer JSON-lines requests until EOF; True when shutdown was requested."""
+        for line in input_stream:
+            stripped = line.strip()
+            if not stripped:
+                continue
+            try:
+                payload = json.loads(stripped)
+            except json.JSONDecodeError as exc:
+                response = {"status": "error", "error": f"JSONDecodeError: {exc}"}
+            else:
+                if isinstance(payload, dict) and payload.get("command") == "shutdown":
+                    output_stream.write(json.dumps({"status": "ok", "command": "shutdown"}) + "\n")
+                    output_stream.flush()
+                    return True
+                response = self.run_request(payload if isinstance(payload, dict) else {})
+            output_stream.write(json.dumps(response) + "\n")
+            output_stream.flush()
+        return False
+
+    def serve_stdio(self, input_stream: TextIO = sys.stdin, output_stream: TextIO = sys.stdout) -> None:
+        """Serve requests from stdin, writing one summary line per request."""
+        try:
+            self._serve_lines(input_stream, output_stream)
+        finally:
+            self.close()
+
+    def serve_socket(self, socket_path: str) -> None:
+        """Serve requests over a local Unix stream socket, one client at a time.
+
+        Renders are CPU-bound and the renderer cache is single-threaded, so
+        connections are handled sequentially; orchestration scripts should
+        multiplex runs over one connection. A client sending
+        `{"command": "shutdown"}` stops the service.
+        """
+        path = Path(socket_path)
+        if path.exists():
+            path.unlink()
+
+        server = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        try:
+            server.bind(str(path))
+            server.listen(1)
+            while True:
+                connection, _ = server.accept()
+                with connection:
+                    reader = connection.makefile("r", encoding="utf-8")
+                    writer = connection.makefile("w", encoding="utf-8")
+                    if self._serve_lines(reader, writer):
+                        return
+        finally:
+            server.close()
+            if path.exists():
+                path.unlink()
+            self.close()
+
+    def close(self) -> None:
+        """Release all cached renderers."""
+        self._cache.clear()
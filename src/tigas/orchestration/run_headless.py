@@ -6,12 +6,29 @@ import argparse
 import json
 
 from tigas.orchestration.ablation_runner import HeadlessAblationRunner
+from tigas.orchestration.render_service import RenderService
 from tigas.shared.types import ExperimentConfig
 
 
 def build_parser() -> argparse.ArgumentParser:
     parser = argparse.ArgumentParser(description="Run a runtime-only headless TIGAS render")
-    parser.add_argument("--ply-path", required=True, help="Path to .ply point cloud")
+    parser.add_argument("--ply-path", default="", help="Path to .ply point cloud")
+    parser.add_argument(
+        "--serve",
+        action="store_true",
+        help="Run as a persistent render service reading JSON-lines requests from stdin",
+    )
+    parser.add_argument(
+        "--serve-socket",
+        default="",
+        help="Run as a persistent render service on this Unix socket path",
+    )
+    parser.add_argument(
+        "--service-cache-size",
+        type=int,
+        default=4,
+        help="Initialized renderers kept warm by the service's LRU cache",
+    )
     parser.add_argument(
         "--movement-trace",
         default="",
@@ -55,10 +72,42 @@ def build_parser() -> argparse.ArgumentParser:
         choices=["cpu", "gsplat_cuda"],
         help="Renderer backend implementation",
     )
+    parser.add_argument(
+        "--cpu-raster-engine",
+        default="scatter",
+        choices=["scatter", "tiled", "fused"],
+        help="Accumulation engine used by the CPU backend",
+    )
+    parser.add_argument(
+        "--pipeline-mode",
+        default="serial",
+        choices=["serial", "pipelined"],
+        help="Run frame callbacks inline or on a bounded-queue sink worker",
+    )
+    parser.add_argument(
+        "--gpu-async-readback",
+        action="store_true",
+        help="Overlap CUDA DtoH frame readback with the next frame's rendering",
+    )
+    parser.add_argument(
+        "--realtime-pacing",
+        action="store_true",
+        help="Pace the loop against trace timestamps and drop frames that miss deadlines",
+    )
+    parser.add_argument(
+        "--enable-metrics",
+        action="store_true",
+        help="Emit per-frame telemetry through the metrics ring buffer to Parquet",
+    )
+    parser.add_argument(
+        "--enable-span-timers",
+        action="store_true",
+        help="Record per-stage render timings and report mean/p95 in the summary",
+    )
     parser.add_argument(
         "--default-lod",
         default="full",
-        choices=["full", "sampled_50", "quant_8bit", "adaptive"],
+        choices=["full", "sampled_50", "sampled_25", "sampled_10", "quant_8bit", "adaptive"],
         help="Requested LOD profile",
     )
     parser.add_argument(
@@ -77,7 +126,22 @@ def build_parser() -> argparse.ArgumentParser:
 
 
 def main() -> None:
-    args = build_parser().parse_args()
+    parser = build_parser()
+    args = parser.parse_args()
+
+    # Service mode ignores per-run flags: every JSON-lines request carries a
+    # full config, so scenes stay warm across heterogeneous sweeps.
+    if args.serve or args.serve_socket:
+        service = RenderService(cache_capacity=args.service_cache_size)
+        if args.serve_socket:
+            service.serve_socket(args.serve_socket)
+        else:
+            service.serve_stdio()
+        return
+
+    if not args.ply_path:
+        parser.error("--ply-path is required unless --serve or --serve-socket is set")
+
     config = ExperimentConfig(
         trace_path=args.movement_trace,
         codec=args.codec,
@@ -97,6 +161,12 @@ def main() -> None:
         max_points=args.max_points,
         renderer_backend=args.renderer_backend,
         quant_bits=args.quant_bits,
+        cpu_raster_engine=args.cpu_raster_engine,
+        pipeline_mode=args.pipeline_mode,
+        enable_metrics=bool(args.enable_metrics),
+        enable_span_timers=bool(args.enable_span_timers),
+        realtime_pacing=bool(args.realtime_pacing),
+        gpu_async_readback=bool(args.gpu_async_readback),
     )
     summary = HeadlessAblationRunner().run_one(config)
     print(json.dumps(summary, indent=2))
@@ -8,11 +8,17 @@ from decoded point clouds and emits RGB frames for experiment orchestration.
 from __future__ import annotations
 
 import math
+import os
+from concurrent.futures import ThreadPoolExecutor
 
 import numpy as np
 
+from tigas.instrumentation.span_timers import NULL_RECORDER, SpanRecorder
+from tigas.renderer import splat_kernel
 from tigas.renderer.interface import RendererBackend
-from tigas.renderer.supersplat_loader import DecodedPointCloud, load_any_3dgs_ply
+from tigas.renderer.scene_cache import load_decoded_cloud_cached
+from tigas.renderer.supersplat_loader import DecodedPointCloud
+from tigas.shared.frame_pool import FramePool
 from tigas.shared.types import RawFrame, RenderRequest
 
 
@@ -27,13 +33,32 @@ class CpuFallbackBackend(RendererBackend):
         fov_degrees: float = 60.0,
         max_points: int = 120_000,
         quant_bits: int = 8,
+        raster_engine: str = "scatter",
+        tile_size: int = 64,
+        raster_workers: int | None = None,
+        enable_frustum_culling: bool = True,
+        use_scene_cache: bool = True,
+        frame_pool: FramePool | None = None,
+        span_recorder: SpanRecorder | None = None,
     ) -> None:
+        if raster_engine not in {"scatter", "tiled", "fused"}:
+            raise ValueError(
+                f"Unsupported raster engine '{raster_engine}'. Use 'scatter', 'tiled', or 'fused'."
+            )
+
         self.point_cloud_path = point_cloud_path
         self.width = int(width)
         self.height = int(height)
         self.fov_degrees = float(fov_degrees)
         self.max_points = int(max_points)
         self.quant_bits = int(max(2, min(16, quant_bits)))
+        self.raster_engine = raster_engine
+        self.tile_size = int(max(16, tile_size))
+        self.raster_workers = int(raster_workers) if raster_workers else max(1, os.cpu_count() or 1)
+        self.enable_frustum_culling = bool(enable_frustum_culling)
+        self.use_scene_cache = bool(use_scene_cache)
+        self._frame_pool = frame_pool or FramePool(width=self.width, height=self.height)
+        self._spans = span_recorder if span_recorder is not None else NULL_RECORDER
 
         self._cloud: DecodedPointCloud | None = None
         self._xyz_h: np.ndarray | None = None
@@ -41,11 +66,18 @@ class CpuFallbackBackend(RendererBackend):
         self._scale_xyz: np.ndarray | None = None
         self._opacity: np.ndarray | None = None
         self._point_indices = np.arange(0, 0, dtype=np.int64)
+        self._lod_tier_counts: dict[str, int] = {}
         self._frame_id = 0
         self._quantized_xyz_h: np.ndarray | None = None
         self._quantized_rgb: np.ndarray | None = None
         self._quantized_scale_xyz: np.ndarray | None = None
         self._quantized_opacity: np.ndarray | None = None
+        self._raster_pool: ThreadPoolExecutor | None = None
+        self._cell_point_order: np.ndarray | None = None
+        self._cell_starts: np.ndarray | None = None
+        self._cell_ends: np.ndarray | None = None
+        self._cell_min: np.ndarray | None = None
+        self._cell_max: np.ndarray | None = None
 
         fov_radians = math.radians(self.fov_degrees)
         focal = (self.width * 0.5) / math.tan(fov_radians * 0.5)
@@ -79,19 +111,33 @@ class CpuFallbackBackend(RendererBackend):
         if not self.point_cloud_path:
             raise ValueError("`point_cloud_path` is required for CPU headless rendering.")
 
-        self._cloud = load_any_3dgs_ply(
+        self._cloud = load_decoded_cloud_cached(
             self.point_cloud_path,
             max_points=self.max_points,
+            use_cache=self.use_scene_cache,
         )
 
         xyz = self._cloud.xyz.astype(np.float32, copy=False)
-        self._rgb = self._cloud.rgb.astype(np.uint8, copy=False)
-        self._scale_xyz = self._cloud.scale_xyz.astype(np.float32, copy=False)
-        self._opacity = self._cloud.opacity.astype(np.float32, copy=False)
+        rgb = self._cloud.rgb.astype(np.uint8, copy=False)
+        scale_xyz = self._cloud.scale_xyz.astype(np.float32, copy=False)
+        opacity = self._cloud.opacity.astype(np.float32, copy=False)
+
+        # Order points once by splat importance so every LOD tier is a
+        # contiguous prefix view rather than a per-frame strided gather.
+        importance = opacity * np.mean(scale_xyz, axis=1)
+        order = np.argsort(-importance, kind="stable")
+        xyz = np.ascontiguousarray(xyz[order])
+        self._rgb = np.ascontiguousarray(rgb[order])
+        self._scale_xyz = np.ascontiguousarray(scale_xyz[order])
+        self._opacity = np.ascontiguousarray(opacity[order])
+
         ones = np.ones((xyz.shape[0], 1), dtype=np.float32)
         self._xyz_h = np.concatenate((xyz, ones), axis=1)
         self._point_indices = np.arange(self._xyz_h.shape[0], dtype=np.int64)
+        self._build_lod_tiers(xyz.shape[0])
         self._prepare_quantized_lod_buffers()
+        if self.enable_frustum_culling:
+            self._build_spatial_index()
         self._frame_id = 0
 
     @staticmethod
@@ -148,10 +194,122 @@ class CpuFallbackBackend(RendererBackend):
         )
         self._quantized_opacity = np.clip(opacity_q[:, 0], 1e-4, 1.0).astype(np.float32)
 
-    def _select_lod_indices(self, lod_id: str) -> np.ndarray:
-        if lod_id == "sampled_50":
-            return self._point_indices[::2]
-        return self._point_indices
+    def _build_spatial_index(self) -> None:
+        """Build a coarse uniform grid over point positions for frustum culling.
+
+        Cell AABBs cover both full-precision and quantized positions so the
+        same index is valid for every LOD variant.
+        """
+        if self._xyz_h is None or self._quantized_xyz_h is None:
+            raise RuntimeError("Renderer is not initialized. Call `initialize()` first.")
+
+        xyz = self._xyz_h[:, :3]
+        point_count = xyz.shape[0]
+        resolution = int(np.clip(round(float(point_count / 64.0) ** (1.0 / 3.0)), 4, 16))
+
+        mins = xyz.min(axis=0)
+        spans = np.maximum(xyz.max(axis=0) - mins, 1e-9)
+        cell_coords = np.clip(
+            ((xyz - mins) / spans * resolution).astype(np.int64), 0, resolution - 1
+        )
+        cell_ids = (
+            cell_coords[:, 0] * resolution * resolution
+            + cell_coords[:, 1] * resolution
+            + cell_coords[:, 2]
+        )
+
+        order = np.argsort(cell_ids, kind="stable")
+        cell_ids_sorted = cell_ids[order]
+        _, starts = np.unique(cell_ids_sorted, return_index=True)
+        ends = np.append(starts[1:], point_count)
+
+        xyz_sorted = xyz[order]
+        xyz_q_sorted = self._quantized_xyz_h[order, :3]
+        cell_min = np.minimum(
+            np.minimum.reduceat(xyz_sorted, starts, axis=0),
+            np.minimum.reduceat(xyz_q_sorted, starts, axis=0),
+        )
+        cell_max = np.maximum(
+            np.maximum.reduceat(xyz_sorted, starts, axis=0),
+            np.maximum.reduceat(xyz_q_sorted, starts, axis=0),
+        )
+
+        self._cell_point_order = order
+        self._cell_starts = starts
+        self._cell_ends = ends
+        self._cell_min = cell_min
+        self._cell_max = cell_max
+
+    def _frustum_visible_mask(self, camera_to_world: np.ndarray) -> np.ndarray | None:
+        """Return a per-point visibility mask, or None when culling is inactive.
+
+        Frustum planes carry a conservative margin so cells intersecting the
+        view volume are always retained; the per-pixel bounds check downstream
+        remains the exact filter.
+        """
+        if (
+            self._cell_point_order is None
+            or self._cell_starts is None
+            or self._cell_ends is None
+            or self._cell_min is None
+            or self._cell_max is None
+        ):
+            return None
+
+        eye = camera_to_world[:3, 3]
+        right = camera_to_world[:3, 0]
+        up = camera_to_world[:3, 1]
+        forward = -camera_to_world[:3, 2]
+
+        margin = 1.1
+        tan_x = (self.width * 0.5) / self._focal_x * margin
+        tan_y = (self.height * 0.5) / self._focal_y * margin
+
+        planes = np.stack(
+            (
+                forward,
+                right + tan_x * forward,
+                -right + tan_x * forward,
+                up + tan_y * forward,
+                -up + tan_y * forward,
+            )
+        ).astype(np.float32)
+
+        visible_cells = np.ones((self._cell_min.shape[0],), dtype=bool)
+        for normal in planes:
+            positive_vertex = np.where(normal[None, :] > 0.0, self._cell_max, self._cell_min)
+            distances = positive_vertex @ normal - float(eye @ normal)
+            visible_cells &= distances >= 0.0
+
+        if bool(np.all(visible_cells)):
+            return None
+
+        mask = np.zeros((self._cell_point_order.shape[0],), dtype=bool)
+        for cell_idx in np.flatnonzero(visible_cells):
+            start = int(self._cell_starts[cell_idx])
+            end = int(self._cell_ends[cell_idx])
+            mask[self._cell_point_order[start:end]] = True
+        return mask
+
+    _LOD_TIER_FRACTIONS = {
+        "full": 1.0,
+        "adaptive": 1.0,
+        "quant_8bit": 1.0,
+        "sampled_50": 0.5,
+        "sampled_25": 0.25,
+        "sampled_10": 0.10,
+    }
+
+    def _build_lod_tiers(self, point_count: int) -> None:
+        self._lod_tier_counts = {
+            lod_id: max(1, int(round(point_count * fraction))) if point_count > 0 else 0
+            for lod_id, fraction in self._LOD_TIER_FRACTIONS.items()
+        }
+
+    def _lod_point_count(self, lod_id: str) -> int:
+        if self._xyz_h is None:
+            raise RuntimeError("Renderer is not initialized. Call `initialize()` first.")
+        return self._lod_tier_counts.get(lod_id, self._xyz_h.shape[0])
 
     @staticmethod
     def _gaussian_kernel_1d(sigma: float) -> np.ndarray:
@@ -181,6 +339,104 @@ class CpuFallbackBackend(RendererBackend):
             return blurred_y[:, :, 0]
         return blurred_y
 
+    def _accumulate_scatter(
+        self,
+        px_valid: np.ndarray,
+        py_valid: np.ndarray,
+        rgb_valid: np.ndarray,
+        opacity_valid: np.ndarray,
+    ) -> tuple[np.ndarray, np.ndarray]:
+        """Single-threaded full-frame scatter accumulation."""
+        pixel_ids = (py_valid * self.width + px_valid).astype(np.int64)
+        accum_weight_flat = np.zeros((self.width * self.height,), dtype=np.float32)
+        accum_color_flat = np.zeros((self.width * self.height, 3), dtype=np.float32)
+
+        np.add.at(accum_weight_flat, pixel_ids, opacity_valid)
+        np.add.at(accum_color_flat[:, 0], pixel_ids, rgb_valid[:, 0] * opacity_valid)
+        np.add.at(accum_color_flat[:, 1], pixel_ids, rgb_valid[:, 1] * opacity_valid)
+        np.add.at(accum_color_flat[:, 2], pixel_ids, rgb_valid[:, 2] * opacity_valid)
+
+        accum_weight = accum_weight_flat.reshape((self.height, self.width))
+        accum_color = accum_color_flat.reshape((self.height, self.width, 3))
+        return accum_weight, accum_color
+
+    def _accumulate_tiled(
+        self,
+        px_valid: np.ndarray,
+        py_valid: np.ndarray,
+        rgb_valid: np.ndarray,
+        opacity_valid: np.ndarray,
+    ) -> tuple[np.ndarray, np.ndarray]:
+        """Tile-parallel accumulation across the raster worker pool.
+
+        Points are binned into screen tiles after projection, each tile is
+        splatted into a tile-local buffer, and worker results are merged into
+        disjoint regions of the output frame.
+        """
+        tiles_x = (self.width + self.tile_size - 1) // self.tile_size
+        tile_ids = (py_valid // self.tile_size) * tiles_x + (px_valid // self.tile_size)
+
+        order = np.argsort(tile_ids, kind="stable")
+        tile_ids_sorted = tile_ids[order]
+        px_sorted = px_valid[order]
+        py_sorted = py_valid[order]
+        weighted_rgb_sorted = rgb_valid[order] * opacity_valid[order][:, None]
+        opacity_sorted = opacity_valid[order]
+
+        unique_tiles, tile_starts = np.unique(tile_ids_sorted, return_index=True)
+        tile_ends = np.append(tile_starts[1:], tile_ids_sorted.shape[0])
+
+        accum_weight = np.zeros((self.height, self.width), dtype=np.float32)
+        accum_color = np.zeros((self.height, self.width, 3), dtype=np.float32)
+
+        def splat_tile_range(range_start: int, range_end: int) -> None:
+            for tile_pos in range(range_start, range_end):
+                tile_id = int(unique_tiles[tile_pos])
+                start = int(tile_starts[tile_pos])
+                end = int(tile_ends[tile_pos])
+
+                tile_x0 = (tile_id % tiles_x) * self.tile_size
+                tile_y0 = (tile_id // tiles_x) * self.tile_size
+                tile_w = min(self.tile_size, self.width - tile_x0)
+                tile_h = min(self.tile_size, self.height - tile_y0)
+
+                local_ids = (py_sorted[start:end] - tile_y0) * tile_w + (px_sorted[start:end] - tile_x0)
+                tile_pixels = tile_w * tile_h
+
+                local_weight = np.bincount(
+                    local_ids, weights=opacity_sorted[start:end], minlength=tile_pixels
+                ).astype(np.float32)
+                local_color = np.empty((tile_pixels, 3), dtype=np.float32)
+                for channel in range(3):
+                    local_color[:, channel] = np.bincount(
+                        local_ids,
+                        weights=weighted_rgb_sorted[start:end, channel],
+                        minlength=tile_pixels,
+                    )
+
+                region_y = slice(tile_y0, tile_y0 + tile_h)
+                region_x = slice(tile_x0, tile_x0 + tile_w)
+                accum_weight[region_y, region_x] = local_weight.reshape((tile_h, tile_w))
+                accum_color[region_y, region_x, :] = local_color.reshape((tile_h, tile_w, 3))
+
+        tile_count = int(unique_tiles.shape[0])
+        workers = min(self.raster_workers, max(1, tile_count))
+        if workers <= 1 or tile_count <= 1:
+            splat_tile_range(0, tile_count)
+            return accum_weight, accum_color
+
+        if self._raster_pool is None:
+            self._raster_pool = ThreadPoolExecutor(max_workers=self.raster_workers)
+
+        chunk = (tile_count + workers - 1) // workers
+        futures = [
+            self._raster_pool.submit(splat_tile_range, start, min(start + chunk, tile_count))
+            for start in range(0, tile_count, chunk)
+        ]
+        for future in futures:
+            future.result()
+        return accum_weight, accum_color
+
     def render(self, request: RenderRequest) -> RawFrame:
         if (
             self._xyz_h is None
@@ -197,7 +453,7 @@ class CpuFallbackBackend(RendererBackend):
         camera_to_world = pose.reshape((4, 4))
         world_to_camera = np.linalg.inv(camera_to_world).astype(np.float32)
 
-        selected = self._select_lod_indices(request.lod_id)
+        tier_count = self._lod_point_count(request.lod_id)
         if request.lod_id == "quant_8bit":
             if (
                 self._quantized_xyz_h is None
@@ -206,16 +462,59 @@ class CpuFallbackBackend(RendererBackend):
                 or self._quantized_opacity is None
             ):
                 raise RuntimeError("Quantized buffers are unavailable.")
-            xyz_h = self._quantized_xyz_h[selected]
-            rgb = self._quantized_rgb[selected]
-            scale_xyz = self._quantized_scale_xyz[selected]
-            opacity = self._quantized_opacity[selected]
+            tier_xyz_h = self._quantized_xyz_h
+            tier_rgb = self._quantized_rgb
+            tier_scale_xyz = self._quantized_scale_xyz
+            tier_opacity = self._quantized_opacity
         else:
-            xyz_h = self._xyz_h[selected]
-            rgb = self._rgb[selected]
-            scale_xyz = self._scale_xyz[selected]
-            opacity = self._opacity[selected]
-
+            tier_xyz_h = self._xyz_h
+            tier_rgb = self._rgb
+            tier_scale_xyz = self._scale_xyz
+            tier_opacity = self._opacity
+
+        cull_start = self._spans.begin()
+        visible_mask = None
+        if self.enable_frustum_culling:
+            visible_mask = self._frustum_visible_mask(camera_to_world)
+
+        if visible_mask is not None:
+            selected = np.flatnonzero(visible_mask[:tier_count])
+            xyz_h = tier_xyz_h[selected]
+            rgb = tier_rgb[selected]
+            scale_xyz = tier_scale_xyz[selected]
+            opacity = tier_opacity[selected]
+        else:
+            # Tiers are contiguous importance-ordered prefixes; plain slicing
+            # keeps this a zero-copy view.
+            xyz_h = tier_xyz_h[:tier_count]
+            rgb = tier_rgb[:tier_count]
+            scale_xyz = tier_scale_xyz[:tier_count]
+            opacity = tier_opacity[:tier_count]
+        self._spans.end("cull_select", cull_start)
+
+        if self.raster_engine == "fused" and splat_kernel.fused_kernel_available():
+            fused_start = self._spans.begin()
+            accum_weight, accum_color, projected_sigma = splat_kernel.accumulate_fused(
+                xyz_h=xyz_h,
+                rgb=rgb,
+                opacity=opacity,
+                scale_xyz=scale_xyz,
+                world_to_camera=world_to_camera,
+                focal_x=self._focal_x,
+                focal_y=self._focal_y,
+                width=self.width,
+                height=self.height,
+            )
+            self._spans.end("accumulate", fused_start)
+            finite_sigma = projected_sigma[np.isfinite(projected_sigma)]
+            if finite_sigma.size > 0:
+                sigma_px = float(np.clip(np.median(finite_sigma) * 1.1, 0.55, 3.0))
+                frame_flat = self._composite(accum_weight, accum_color, sigma_px)
+            else:
+                frame_flat = np.zeros((self.width * self.height, 3), dtype=np.uint8)
+            return self._emit_frame(frame_flat)
+
+        project_start = self._spans.begin()
         camera_space = xyz_h @ world_to_camera.T
         depth = -camera_space[:, 2]
         valid = depth > 1e-4
@@ -236,6 +535,7 @@ class CpuFallbackBackend(RendererBackend):
         valid &= px < self.width
         valid &= py >= 0
         valid &= py < self.height
+        self._spans.end("project", project_start)
 
         frame_flat = np.zeros((self.width * self.height, 3), dtype=np.uint8)
         if np.any(valid):
@@ -246,33 +546,44 @@ class CpuFallbackBackend(RendererBackend):
             opacity_valid = np.clip(opacity[valid], 0.02, 1.0).astype(np.float32)
             scale_valid = scale_xyz[valid]
 
-            pixel_ids = (py_valid * self.width + px_valid).astype(np.int64)
-            accum_weight_flat = np.zeros((self.width * self.height,), dtype=np.float32)
-            accum_color_flat = np.zeros((self.width * self.height, 3), dtype=np.float32)
-
-            np.add.at(accum_weight_flat, pixel_ids, opacity_valid)
-            np.add.at(accum_color_flat[:, 0], pixel_ids, rgb_valid[:, 0] * opacity_valid)
-            np.add.at(accum_color_flat[:, 1], pixel_ids, rgb_valid[:, 1] * opacity_valid)
-            np.add.at(accum_color_flat[:, 2], pixel_ids, rgb_valid[:, 2] * opacity_valid)
-
-            accum_weight = accum_weight_flat.reshape((self.height, self.width))
-            accum_color = accum_color_flat.reshape((self.height, self.width, 3))
+            accumulate_start = self._spans.begin()
+            if self.raster_engine == "tiled":
+                accum_weight, accum_color = self._accumulate_tiled(
+                    px_valid, py_valid, rgb_valid, opacity_valid
+                )
+            else:
+                accum_weight, accum_color = self._accumulate_scatter(
+                    px_valid, py_valid, rgb_valid, opacity_valid
+                )
+            self._spans.end("accumulate", accumulate_start)
 
             mean_scale = np.mean(scale_valid, axis=1)
             projected_sigma = (self._focal_x * mean_scale) / np.maximum(depth_valid, 1e-6)
             sigma_px = float(np.clip(np.median(projected_sigma) * 1.1, 0.55, 3.0))
-            kernel = self._gaussian_kernel_1d(sigma_px)
-
-            smooth_weight = self._blur_2d(accum_weight, kernel)
-            smooth_color = self._blur_2d(accum_color, kernel)
-
-            eps = 1e-6
-            normalized = smooth_color / np.maximum(smooth_weight[:, :, None], eps)
-            alpha = np.clip(smooth_weight, 0.0, 1.0)
-            frame_float = np.clip(normalized * alpha[:, :, None], 0.0, 1.0)
-            frame_flat = np.round(frame_float.reshape((-1, 3)) * 255.0).astype(np.uint8)
-
-        frame_rgb = frame_flat.reshape((self.height, self.width, 3))
+            frame_flat = self._composite(accum_weight, accum_color, sigma_px)
+
+        return self._emit_frame(frame_flat)
+
+    def _composite(self, accum_weight: np.ndarray, accum_color: np.ndarray, sigma_px: float) -> np.ndarray:
+        """Blur and normalize accumulation buffers into a flat uint8 frame."""
+        blur_start = self._spans.begin()
+        kernel = self._gaussian_kernel_1d(sigma_px)
+        smooth_weight = self._blur_2d(accum_weight, kernel)
+        smooth_color = self._blur_2d(accum_color, kernel)
+        self._spans.end("blur", blur_start)
+
+        composite_start = self._spans.begin()
+        eps = 1e-6
+        normalized = smooth_color / np.maximum(smooth_weight[:, :, None], eps)
+        alpha = np.clip(smooth_weight, 0.0, 1.0)
+        frame_float = np.clip(normalized * alpha[:, :, None], 0.0, 1.0)
+        frame_flat = np.round(frame_float.reshape((-1, 3)) * 255.0).astype(np.uint8)
+        self._spans.end("composite", composite_start)
+        return frame_flat
+
+    def _emit_frame(self, frame_flat: np.ndarray) -> RawFrame:
+        buffer = self._frame_pool.acquire()
+        np.copyto(buffer.reshape((-1, 3)), frame_flat)
 
         frame_id = self._frame_id
         self._frame_id += 1
@@ -282,11 +593,18 @@ class CpuFallbackBackend(RendererBackend):
             height=self.height,
             pixel_format="rgb24",
             is_keyframe_hint=(frame_id % 30 == 0),
-            data=frame_rgb.tobytes(),
+            data=memoryview(buffer.reshape(-1)),
         )
 
+    def recycle(self, frame: RawFrame) -> None:
+        """Return the frame's pooled buffer for reuse."""
+        self._frame_pool.release(frame.data)
+
     def shutdown(self) -> None:
         """Release decoded arrays."""
+        if self._raster_pool is not None:
+            self._raster_pool.shutdown(wait=False)
+            self._raster_pool = None
         self._cloud = None
         self._xyz_h = None
         self._rgb = None
@@ -296,4 +614,10 @@ class CpuFallbackBackend(RendererBackend):
         self._quantized_rgb = None
         self._quantized_scale_xyz = None
         self._quantized_opacity = None
+        self._cell_point_order = None
+        self._cell_starts = None
+        self._cell_ends = None
+        self._cell_min = None
+        self._cell_max = None
+        self._lod_tier_counts = {}
         self._point_indices = np.arange(0, 0, dtype=np.int64)
@@ -16,7 +16,8 @@ from pathlib import Path
 import numpy as np
 
 from tigas.renderer.interface import RendererBackend
-from tigas.renderer.supersplat_loader import DecodedPointCloud, load_any_3dgs_ply
+from tigas.renderer.scene_cache import load_decoded_cloud_cached
+from tigas.renderer.supersplat_loader import DecodedPointCloud
 from tigas.shared.types import RawFrame, RenderRequest
 
 
@@ -31,8 +32,12 @@ class GsplatCudaBackend(RendererBackend):
         fov_degrees: float = 60.0,
         max_points: int = 120_000,
         quant_bits: int = 8,
+        use_scene_cache: bool = True,
+        async_readback: bool = False,
     ) -> None:
         self.point_cloud_path = point_cloud_path
+        self.use_scene_cache = bool(use_scene_cache)
+        self.async_readback = bool(async_readback)
         self.width = int(width)
         self.height = int(height)
         self.fov_degrees = float(fov_degrees)
@@ -55,6 +60,16 @@ class GsplatCudaBackend(RendererBackend):
         self._quantized_opacities = None
         self._quantized_colors = None
 
+        # Double-buffered async readback state (allocated on initialize when
+        # `async_readback` is set).
+        self._copy_stream = None
+        self._device_u8 = None
+        self._host_pinned = None
+        self._host_views = None
+        self._render_done_events = None
+        self._copy_done_events = None
+        self._pending_emit: tuple[int, int] | None = None
+
     @staticmethod
     def _prepend_env_path(var_name: str, path: Path) -> None:
         path_str = str(path)
@@ -170,12 +185,15 @@ class GsplatCudaBackend(RendererBackend):
         self._rasterization = rasterization
         self._device = torch.device("cuda")
 
-        self._cloud = load_any_3dgs_ply(
-            file_path=self.point_cloud_path,
+        self._cloud = load_decoded_cloud_cached(
+            self.point_cloud_path,
             max_points=self.max_points,
+            use_cache=self.use_scene_cache,
         )
 
-        means = torch.from_numpy(self._cloud.xyz.astype(np.float32, copy=False)).to(self._device)
+        # Copy here: cached clouds are read-only memmaps and torch.from_numpy
+        # requires writable host arrays.
+        means = torch.from_numpy(self._cloud.xyz.astype(np.float32)).to(self._device)
         scales = torch.from_numpy(
             np.clip(self._cloud.scale_xyz.astype(np.float32, copy=False), 1e-6, 10.0)
         ).to(self._device)
@@ -206,8 +224,33 @@ class GsplatCudaBackend(RendererBackend):
         self._colors = colors
         self._camera_intrinsics = camera_intrinsics
         self._prepare_quantized_tensors()
+        if self.async_readback:
+            self._prepare_readback_buffers()
         self._frame_id = 0
 
+    def _prepare_readback_buffers(self) -> None:
+        """Allocate the double-buffered DtoH readback machinery.
+
+        Two device-side uint8 staging tensors, two pinned host buffers and a
+        dedicated copy stream let frame N render while frame N-1 transfers
+        over PCIe; the pinned buffers back `RawFrame.data` directly, so the
+        readback adds no host-side copy.
+        """
+        torch = self._torch
+        self._copy_stream = torch.cuda.Stream()
+        self._device_u8 = [
+            torch.empty((self.height, self.width, 3), dtype=torch.uint8, device=self._device)
+            for _ in range(2)
+        ]
+        self._host_pinned = [
+            torch.empty((self.height, self.width, 3), dtype=torch.uint8, pin_memory=True)
+            for _ in range(2)
+        ]
+        self._host_views = [buffer.numpy() for buffer in self._host_pinned]
+        self._render_done_events = [torch.cuda.Event() for _ in range(2)]
+        self._copy_done_events = [torch.cuda.Event() for _ in range(2)]
+        self._pending_emit = None
+
     def _prepare_quantized_tensors(self) -> None:
         if (
             self._means is None
@@ -323,10 +366,13 @@ class GsplatCudaBackend(RendererBackend):
             rasterize_mode="antialiased",
         )
 
-        frame_rgb = self._to_uint8_frame(render_colors[0].detach().cpu().numpy())
-
         frame_id = self._frame_id
         self._frame_id += 1
+
+        if self.async_readback and self._copy_stream is not None:
+            return self._emit_async(render_colors[0].detach(), frame_id)
+
+        frame_rgb = self._to_uint8_frame(render_colors[0].detach().cpu().numpy())
         return RawFrame(
             frame_id=frame_id,
             width=self.width,
@@ -336,6 +382,46 @@ class GsplatCudaBackend(RendererBackend):
             data=frame_rgb.tobytes(),
         )
 
+    def _emit_async(self, render_colors, frame_id: int) -> RawFrame:
+        """Queue the DtoH copy of this frame and emit the previous one.
+
+        Frame N's uint8 conversion stays on the render stream; the dedicated
+        copy stream waits on it and transfers into a pinned host buffer while
+        frame N+1 renders. Output therefore lags rendering by one frame (the
+        first frame is emitted synchronously, then again on the next call as
+        the pipeline primes). The returned `RawFrame.data` aliases a pinned
+        buffer that is reused two render calls later, so consumers must be
+        done with it by then — the same borrowing contract as the CPU
+        backend's frame pool.
+        """
+        torch = self._torch
+        slot = frame_id & 1
+        staging = self._device_u8[slot]
+        # GPU-side conversion keeps the PCIe transfer at 3 bytes per pixel;
+        # copy_ casts float32 -> uint8 on device without a temporary.
+        staging.copy_(render_colors.clamp_(0.0, 1.0).mul_(255.0).round_())
+        self._render_done_events[slot].record()
+        with torch.cuda.stream(self._copy_stream):
+            self._copy_stream.wait_event(self._render_done_events[slot])
+            self._host_pinned[slot].copy_(staging, non_blocking=True)
+            self._copy_done_events[slot].record()
+
+        previous = self._pending_emit
+        self._pending_emit = (slot, frame_id)
+        if previous is None:
+            previous = self._pending_emit
+        emit_slot, emit_id = previous
+
+        self._copy_done_events[emit_slot].synchronize()
+        return RawFrame(
+            frame_id=emit_id,
+            width=self.width,
+            height=self.height,
+            pixel_format="rgb24",
+            is_keyframe_hint=(emit_id % 30 == 0),
+            data=memoryview(self._host_views[emit_slot].reshape(-1)),
+        )
+
     def shutdown(self) -> None:
         self._cloud = None
         self._means = None
@@ -348,6 +434,13 @@ class GsplatCudaBackend(RendererBackend):
         self._quantized_scales = None
         self._quantized_opacities = None
         self._quantized_colors = None
+        self._copy_stream = None
+        self._device_u8 = None
+        self._host_pinned = None
+        self._host_views = None
+        self._render_done_events = None
+        self._copy_done_events = None
+        self._pending_emit = None
         self._frame_id = 0
 
         if self._torch is not None and self._torch.cuda.is_available():
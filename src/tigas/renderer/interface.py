@@ -27,6 +27,13 @@ class RendererBackend(ABC):
     def render(self, request: RenderRequest) -> RawFrame:
         """Render a frame for the given pose, LOD, and time offset."""
 
+    def recycle(self, frame: RawFrame) -> None:
+        """Return a frame's pooled buffer for reuse.
+
+        Backends without pooled output buffers can keep this default no-op.
+        Callers must not touch `frame.data` after recycling.
+        """
+
     @abstractmethod
     def shutdown(self) -> None:
         """Release backend resources."""
@@ -0,0 +1,110 @@
+"""Decoded-scene sidecar cache for fast repeated startup.
+
+First decode of a PLY persists the `DecodedPointCloud` arrays as `.npy` files
+in a sidecar directory next to the source asset. Later loads open the arrays
+with `np.load(mmap_mode="r")`, so repeated sweep runs pay neither header
+parsing nor SuperSplat bit-unpacking and pages are faulted in lazily.
+"""
+
+from __future__ import annotations
+
+import json
+import os
+import tempfile
+from pathlib import Path
+
+import numpy as np
+
+from tigas.renderer.supersplat_loader import DecodedPointCloud, load_any_3dgs_ply
+
+_CACHE_VERSION = 1
+_ARRAY_NAMES = ("xyz", "scale_xyz", "rgb", "opacity")
+
+
+def _cache_dir(path: Path, max_points: int | None) -> Path:
+    """Return the cache key directory for one (asset, point budget) pair."""
+    stat = path.stat()
+    key = (
+        f"v{_CACHE_VERSION}_mp{max_points or 0}"
+        f"_sz{stat.st_size}_mt{stat.st_mtime_ns}"
+    )
+    return path.parent / f"{path.name}.tigas_cache" / key
+
+
+def _write_cache(cache_dir: Path, cloud: DecodedPointCloud) -> None:
+    """Persist decoded arrays atomically via a temp directory rename."""
+    cache_dir.parent.mkdir(parents=True, exist_ok=True)
+    staging = Path(tempfile.mkdtemp(prefix=".staging_", dir=cache_dir.parent))
+    try:
+        for name in _ARRAY_NAMES:
+            np.save(staging / f"{name}.npy", getattr(cloud, name))
+        meta = {
+            "center": [float(value) for value in cloud.center],
+            "radius": float(cloud.radius),
+            "point_count": int(cloud.point_count),
+            "chunk_count": int(cloud.chunk_count),
+            "encoding": cloud.encoding,
+            "source_path": cloud.source_path,
+        }
+        with (staging / "meta.json").open("w", encoding="utf-8") as handle:
+            json.dump(meta, handle)
+        os.replace(staging, cache_dir)
+    except OSError:
+        # A concurrent process may have populated the key first; keep theirs.
+        import shutil
+
+        shutil.rmtree(staging, ignore_errors=True)
+
+
+def _load_from_cache(cache_dir: Path) -> DecodedPointCloud:
+    with (cache_dir / "meta.json").open("r", encoding="utf-8") as handle:
+        meta = json.load(handle)
+
+    arrays = {
+        name: np.load(cache_dir / f"{name}.npy", mmap_mode="r") for name in _ARRAY_NAMES
+    }
+    return DecodedPointCloud(
+        xyz=arrays["xyz"],
+        scale_xyz=arrays["scale_xyz"],
+        rgb=arrays["rgb"],
+        opacity=arrays["opacity"],
+        center=np.asarray(meta["center"], dtype=np.float32),
+        radius=float(meta["radius"]),
+        point_count=int(meta["point_count"]),
+        chunk_count=int(meta["chunk_count"]),
+        encoding=str(meta["encoding"]),
+        source_path=str(meta["source_path"]),
+    )
+
+
+def load_decoded_cloud_cached(
+    file_path: str,
+    max_points: int | None = None,
+    use_cache: bool = True,
+) -> DecodedPointCloud:
+    """Load a decoded point cloud, reusing the sidecar cache when available.
+
+    Cache misses decode through `load_any_3dgs_ply` and then populate the
+    sidecar; cache writes are best-effort so read-only asset directories
+    degrade to plain decoding instead of failing the run.
+    """
+    path = Path(file_path)
+    if not path.exists():
+        raise FileNotFoundError(f"Point cloud file not found: {file_path}")
+
+    if not use_cache:
+        return load_any_3dgs_ply(file_path=file_path, max_points=max_points)
+
+    cache_dir = _cache_dir(path, max_points)
+    if (cache_dir / "meta.json").exists():
+        try:
+            return _load_from_cache(cache_dir)
+        except (OSError, ValueError, KeyError):
+            pass
+
+    cloud = load_any_3dgs_ply(file_path=file_path, max_points=max_points)
+    try:
+        _write_cache(cache_dir, cloud)
+    except OSError:  # pragma: no cover - filesystem-permission dependent
+        pass
+    return cloud
@@ -0,0 +1,134 @@
+"""Optional compiled splatting kernel for the CPU backend.
+
+The fused kernel performs projection, bounds checking, and weighted color
+accumulation in a single pass over the point arrays, replacing the scattered
+`np.add.at` hot path. Numba is an optional dependency: when it is missing the
+CPU backend silently falls back to its pure-NumPy accumulation engines.
+"""
+
+from __future__ import annotations
+
+import numpy as np
+
+_FUSED_KERNEL = None
+_KERNEL_CHECKED = False
+
+
+def _build_fused_kernel():
+    try:
+        from numba import njit
+    except Exception:  # pragma: no cover - depends on optional numba install
+        return None
+
+    @njit(cache=True, fastmath=True)
+    def _fused(
+        xyz_h,
+        rgb,
+        opacity,
+        mean_scale,
+        world_to_camera,
+        focal_x,
+        focal_y,
+        width,
+        height,
+        accum_weight,
+        accum_color,
+        projected_sigma,
+    ):  # pragma: no cover - compiled path exercised only when numba is present
+        half_width = width * 0.5
+        half_height = height * 0.5
+        for i in range(xyz_h.shape[0]):
+            x = xyz_h[i, 0]
+            y = xyz_h[i, 1]
+            z = xyz_h[i, 2]
+            cam_x = world_to_camera[0, 0] * x + world_to_camera[0, 1] * y + world_to_camera[0, 2] * z + world_to_camera[0, 3]
+            cam_y = world_to_camera[1, 0] * x + world_to_camera[1, 1] * y + world_to_camera[1, 2] * z + world_to_camera[1, 3]
+            cam_z = world_to_camera[2, 0] * x + world_to_camera[2, 1] * y + world_to_camera[2, 2] * z + world_to_camera[2, 3]
+
+            depth = -cam_z
+            if depth <= 1e-4:
+                continue
+
+            safe_depth = depth if depth > 1e-6 else 1e-6
+            projected_x = (cam_x / safe_depth) * focal_x + half_width
+            projected_y = half_height - (cam_y / safe_depth) * focal_y
+            if not (np.isfinite(projected_x) and np.isfinite(projected_y)):
+                continue
+
+            px = int(projected_x)
+            py = int(projected_y)
+            if px < 0 or px >= width or py < 0 or py >= height:
+                continue
+
+            alpha = opacity[i]
+            if alpha < 0.02:
+                alpha = 0.02
+            elif alpha > 1.0:
+                alpha = 1.0
+
+            pixel_id = py * width + px
+            accum_weight[pixel_id] += alpha
+            accum_color[pixel_id, 0] += (rgb[i, 0] / 255.0) * alpha
+            accum_color[pixel_id, 1] += (rgb[i, 1] / 255.0) * alpha
+            accum_color[pixel_id, 2] += (rgb[i, 2] / 255.0) * alpha
+            projected_sigma[i] = (focal_x * mean_scale[i]) / safe_depth
+
+    return _fused
+
+
+def fused_kernel_available() -> bool:
+    """Return True when the compiled kernel can be used on this host."""
+    global _FUSED_KERNEL, _KERNEL_CHECKED
+    if not _KERNEL_CHECKED:
+        _FUSED_KERNEL = _build_fused_kernel()
+        _KERNEL_CHECKED = True
+    return _FUSED_KERNEL is not None
+
+
+def accumulate_fused(
+    xyz_h: np.ndarray,
+    rgb: np.ndarray,
+    opacity: np.ndarray,
+    scale_xyz: np.ndarray,
+    world_to_camera: np.ndarray,
+    focal_x: float,
+    focal_y: float,
+    width: int,
+    height: int,
+) -> tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """Run the fused projection and accumulation kernel.
+
+    Returns per-frame weight and color accumulation buffers plus per-point
+    projected sigma values (NaN for culled points) used for blur sizing.
+    Raises RuntimeError when numba is unavailable; callers should check
+    `fused_kernel_available()` first and fall back to the NumPy engines.
+    """
+    if not fused_kernel_available():
+        raise RuntimeError("Fused splat kernel requires numba, which is not installed.")
+
+    point_count = xyz_h.shape[0]
+    accum_weight = np.zeros((width * height,), dtype=np.float32)
+    accum_color = np.zeros((width * height, 3), dtype=np.float32)
+    projected_sigma = np.full((point_count,), np.nan, dtype=np.float32)
+    mean_scale = np.mean(scale_xyz, axis=1).astype(np.float32)
+
+    _FUSED_KERNEL(
+        np.ascontiguousarray(xyz_h, dtype=np.float32),
+        np.ascontiguousarray(rgb, dtype=np.float32),
+        np.ascontiguousarray(opacity, dtype=np.float32),
+        mean_scale,
+        np.ascontiguousarray(world_to_camera, dtype=np.float32),
+        np.float32(focal_x),
+        np.float32(focal_y),
+        int(width),
+        int(height),
+        accum_weight,
+        accum_color,
+        projected_sigma,
+    )
+
+    return (
+        accum_weight.reshape((height, width)),
+        accum_color.reshape((height, width, 3)),
+        projected_sigma,
+    )
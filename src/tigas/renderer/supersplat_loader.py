@@ -173,6 +173,10 @@ def load_supersplat_compressed_ply(
 
     The decoder intentionally focuses on packed position and packed color fields
     which are sufficient for headless quality and performance experiments.
+
+    The vertex region is memory-mapped and only the records selected by
+    `_sample_indices` are materialized, so point-budgeted loads of very large
+    assets never page in the full packed array.
     """
     path = Path(file_path)
     if not path.exists():
@@ -191,22 +195,32 @@ def load_supersplat_compressed_ply(
 
         handle.seek(data_offset)
         chunks = np.fromfile(handle, dtype=_CHUNK_DTYPE, count=chunk_count)
-        vertices = np.fromfile(handle, dtype=_VERTEX_DTYPE, count=vertex_count)
 
     if chunks.shape[0] != chunk_count:
         raise ValueError(
             f"Could not read all chunk records (expected {chunk_count}, got {chunks.shape[0]})."
         )
-    if vertices.shape[0] != vertex_count:
+
+    vertex_offset = data_offset + chunk_count * _CHUNK_DTYPE.itemsize
+    readable_vertices = (path.stat().st_size - vertex_offset) // _VERTEX_DTYPE.itemsize
+    if readable_vertices < vertex_count:
         raise ValueError(
-            f"Could not read all vertex records (expected {vertex_count}, got {vertices.shape[0]})."
+            f"Could not read all vertex records (expected {vertex_count}, got {readable_vertices})."
         )
 
     chunk_stride = max(1, int(math.ceil(vertex_count / chunk_count)))
     vertex_indices = _sample_indices(vertex_count, max_points)
     chunk_indices = np.minimum(vertex_indices // chunk_stride, chunk_count - 1)
 
-    vertices = vertices[vertex_indices]
+    vertex_memmap = np.memmap(
+        path,
+        dtype=_VERTEX_DTYPE,
+        mode="r",
+        offset=vertex_offset,
+        shape=(vertex_count,),
+    )
+    vertices = np.asarray(vertex_memmap[vertex_indices])
+    del vertex_memmap
 
     packed_position = vertices["packed_position"]
     qx = (packed_position & 0x3FF).astype(np.float32)
@@ -28,6 +28,10 @@ class RenderConfig:
     backend: str = "cpu"
     default_lod: str = "full"
     target_fps: int = 30
+    point_cloud_path: str = ""
+    width: int = 960
+    height: int = 540
+    max_points: int = 120000
 
 
 @dataclass(slots=True)
@@ -0,0 +1,56 @@
+"""Reusable frame buffer pool for zero-copy frame handoff.
+
+Renderers write pixels into pooled buffers and publish them as memoryview
+payloads on `RawFrame`; downstream consumers borrow the view for the duration
+of their callback and the runner recycles the buffer afterwards. This removes
+the per-frame `tobytes()`/`frombuffer().copy()` pair and the allocator churn
+it causes at streaming frame rates.
+"""
+
+from __future__ import annotations
+
+import threading
+from collections import deque
+
+import numpy as np
+
+
+class FramePool:
+    """Fixed-shape pool of uint8 frame buffers with bounded retention."""
+
+    def __init__(self, width: int, height: int, channels: int = 3, capacity: int = 4) -> None:
+        self.width = int(width)
+        self.height = int(height)
+        self.channels = int(channels)
+        self.capacity = max(1, int(capacity))
+        self._free: deque[np.ndarray] = deque()
+        self._lock = threading.Lock()
+
+    @property
+    def frame_nbytes(self) -> int:
+        return self.width * self.height * self.channels
+
+    def acquire(self) -> np.ndarray:
+        """Return a writable (height, width, channels) uint8 buffer.
+
+        Allocates a fresh buffer when the free list is empty, so consumers
+        that hold views longer than one frame degrade to plain allocation
+        instead of deadlocking the render loop.
+        """
+        with self._lock:
+            if self._free:
+                return self._free.popleft()
+        return np.empty((self.height, self.width, self.channels), dtype=np.uint8)
+
+    def release(self, payload: "np.ndarray | memoryview | bytes") -> None:
+        """Return a borrowed buffer (or its memoryview) to the free list."""
+        if isinstance(payload, bytes):
+            return  # Immutable payloads are not pool-backed.
+
+        buffer = np.frombuffer(payload, dtype=np.uint8)
+        if buffer.nbytes != self.frame_nbytes:
+            return
+        buffer = buffer.reshape((self.height, self.width, self.channels))
+        with self._lock:
+            if len(self._free) < self.capacity:
+                self._free.append(buffer)
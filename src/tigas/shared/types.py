@@ -10,10 +10,12 @@ from __future__ import annotations
 from dataclasses import dataclass, field
 from typing import Dict, Literal, Optional
 
-LodId = Literal["full", "sampled_50", "quant_8bit", "adaptive"]
+LodId = Literal["full", "sampled_50", "sampled_25", "sampled_10", "quant_8bit", "adaptive"]
 CodecId = Literal["h264_nvenc", "av1_nvenc", "libx264", "videotoolbox_h264"]
 ObjectPriority = Literal["high", "normal"]
 RendererBackendId = Literal["cpu", "gsplat_cuda"]
+CpuRasterEngine = Literal["scatter", "tiled", "fused"]
+PipelineMode = Literal["serial", "pipelined"]
 
 
 @dataclass(slots=True)
@@ -47,14 +49,19 @@ class RenderRequest:
 
 @dataclass(slots=True)
 class RawFrame:
-    """Renderer output frame before compression and packaging."""
+    """Renderer output frame before compression and packaging.
+
+    `data` may be a memoryview borrowed from a renderer-owned frame pool;
+    consumers that retain pixels past their callback must copy, and the
+    runner recycles pooled buffers via `RendererBackend.recycle`.
+    """
 
     frame_id: int
     width: int
     height: int
     pixel_format: str
     is_keyframe_hint: bool
-    data: bytes
+    data: bytes | memoryview
 
 
 @dataclass(slots=True)
@@ -113,3 +120,9 @@ class ExperimentConfig:
     max_points: int = 120000
     renderer_backend: RendererBackendId = "cpu"
     quant_bits: int = 8
+    cpu_raster_engine: CpuRasterEngine = "scatter"
+    pipeline_mode: PipelineMode = "serial"
+    enable_metrics: bool = False
+    enable_span_timers: bool = False
+    realtime_pacing: bool = False
+    gpu_async_readback: bool = False
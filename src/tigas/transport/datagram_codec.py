@@ -0,0 +1,98 @@
+"""Fixed-layout binary codec for uplink control datagrams.
+
+Replaces JSON on the 60-200 Hz control path with one flat little-endian
+struct so a datagram always fits the same 81 bytes and leaves QUIC datagram
+MTU headroom:
+
+    seq_id              uint32
+    timestamp_ms        float64
+    camera_matrix_4x4   16 x float32
+    requested_lod       uint8 enum
+    target_bitrate_kbps uint32
+
+The layout is mirrored by the encoder in `web/src/uplink_datagram.ts`; the
+LOD enum table below must stay in sync with it. Field semantics match
+`schemas/uplink_datagram.schema.json`.
+"""
+
+from __future__ import annotations
+
+import struct
+
+from tigas.shared.types import UplinkDatagram
+
+_WIRE_STRUCT = struct.Struct("<Id16fBI")
+
+_LOD_TO_CODE = {
+    "full": 0,
+    "sampled_50": 1,
+    "sampled_25": 2,
+    "sampled_10": 3,
+    "quant_8bit": 4,
+    "adaptive": 5,
+}
+_CODE_TO_LOD = {code: lod for lod, code in _LOD_TO_CODE.items()}
+
+DATAGRAM_WIRE_SIZE = _WIRE_STRUCT.size
+
+
+class UplinkDatagramCodec:
+    """Pack and unpack uplink datagrams as fixed-size binary records.
+
+    `encode_into` reuses one internal buffer per codec instance, so a
+    steady-state sender allocates nothing per datagram. The returned
+    memoryview is only valid until the next `encode_into` call.
+    """
+
+    def __init__(self) -> None:
+        self._buffer = bytearray(DATAGRAM_WIRE_SIZE)
+        self._view = memoryview(self._buffer)
+
+    @staticmethod
+    def _lod_code(requested_lod: str) -> int:
+        code = _LOD_TO_CODE.get(requested_lod)
+        if code is None:
+            raise ValueError(f"Unknown requested_lod for binary encoding: {requested_lod}")
+        return code
+
+    def encode_into(self, datagram: UplinkDatagram) -> memoryview:
+        """Encode into the reusable internal buffer without allocating."""
+        _WIRE_STRUCT.pack_into(
+            self._buffer,
+            0,
+            datagram.seq_id,
+            datagram.timestamp_ms,
+            *datagram.camera_matrix_4x4,
+            self._lod_code(datagram.requested_lod),
+            max(1, datagram.target_bitrate_kbps),
+        )
+        return self._view
+
+    def encode(self, datagram: UplinkDatagram) -> bytes:
+        """Encode into a fresh bytes object (copying variant)."""
+        return _WIRE_STRUCT.pack(
+            datagram.seq_id,
+            datagram.timestamp_ms,
+            *datagram.camera_matrix_4x4,
+            self._lod_code(datagram.requested_lod),
+            max(1, datagram.target_bitrate_kbps),
+        )
+
+    def decode(self, payload: bytes | bytearray | memoryview, offset: int = 0) -> UplinkDatagram:
+        """Decode one fixed-size record into the canonical datagram object."""
+        if len(payload) - offset < DATAGRAM_WIRE_SIZE:
+            raise ValueError(
+                f"Uplink datagram payload too short: need {DATAGRAM_WIRE_SIZE} bytes, "
+                f"got {len(payload) - offset}."
+            )
+        fields = _WIRE_STRUCT.unpack_from(payload, offset)
+        lod = _CODE_TO_LOD.get(fields[18])
+        if lod is None:
+            raise ValueError(f"Unknown requested_lod code in payload: {fields[18]}")
+        return UplinkDatagram(
+            seq_id=int(fields[0]),
+            timestamp_ms=float(fields[1]),
+            camera_matrix_4x4=list(fields[2:18]),
+            requested_lod=lod,
+            target_bitrate_kbps=int(fields[19]),
+        )
@@ -1,17 +1,112 @@
-"""MoQ publisher placeholder.
+"""MoQ publisher.
 
 This module is responsible for publishing CMAF fragments as MoQ objects while
 respecting per-object priority metadata.
+
+Scheduling model: a two-level send queue drained by a single sender thread.
+`high` fragments (keyframes, per `media/priority.assign_object_priority`)
+always transmit before queued `normal` fragments; enqueuing a keyframe drops
+any queued normal fragments of the same track that it supersedes, and the
+queue is bounded so a slow link back-pressures the encoder by blocking
+`publish` instead of ballooning memory. This late-drop behavior keeps
+motion-to-photon latency flat when throughput dips.
 """
 
 from __future__ import annotations
 
+import threading
+from collections import deque
+from typing import Callable
+
 from tigas.shared.types import CmafFragment
 
+TransportSend = Callable[[CmafFragment], None]
+
 
 class MoqObjectPublisher:
-    """Placeholder for prioritized object publication over MoQ."""
+    """Prioritized object publication over MoQ with a bounded send queue."""
+
+    def __init__(self, transport_send: TransportSend, max_queue_depth: int = 16) -> None:
+        if max_queue_depth < 1:
+            raise ValueError("max_queue_depth must be at least 1.")
+
+        self._transport_send = transport_send
+        self._max_queue_depth = int(max_queue_depth)
+        self._high: deque[CmafFragment] = deque()
+        self._normal: deque[CmafFragment] = deque()
+        self._state = threading.Condition()
+        self._closed = False
+        self._error: BaseException | None = None
+
+        self.published_fragments = 0
+        self.dropped_stale_fragments = 0
+
+        self._thread = threading.Thread(target=self._run, name="tigas-moq-sender", daemon=True)
+        self._thread.start()
+
+    def _queued(self) -> int:
+        return len(self._high) + len(self._normal)
+
+    def _drop_superseded(self, keyframe: CmafFragment) -> None:
+        """Drop queued normal fragments the incoming keyframe makes stale."""
+        kept = deque(
+            fragment
+            for fragment in self._normal
+            if fragment.track_id != keyframe.track_id
+            or fragment.timestamp_ms >= keyframe.timestamp_ms
+        )
+        self.dropped_stale_fragments += len(self._normal) - len(kept)
+        self._normal = kept
 
     def publish(self, fragment: CmafFragment) -> None:
-        """Publish one CMAF fragment as a MoQ object."""
-        raise NotImplementedError("Implement MoQ object publication path.")
+        """Publish one CMAF fragment as a MoQ object.
+
+        Blocks while the bounded queue is full, back-pressuring the encoder.
+        Keyframes first evict the normal fragments they supersede, so they
+        rarely wait.
+        """
+        with self._state:
+            if self._error is not None:
+                raise RuntimeError("MoQ sender failed.") from self._error
+            if self._closed:
+                raise RuntimeError("Publisher is closed.")
+
+            if fragment.priority == "high":
+                self._drop_superseded(fragment)
+                while self._queued() >= self._max_queue_depth and not self._closed:
+                    self._state.wait()
+                self._high.append(fragment)
+            else:
+                while self._queued() >= self._max_queue_depth and not self._closed:
+                    self._state.wait()
+                self._normal.append(fragment)
+            self._state.notify_all()
+
+    def _run(self) -> None:
+        while True:
+            with self._state:
+                while not self._high and not self._normal and not self._closed:
+                    self._state.wait()
+                if not self._high and not self._normal:
+                    return
+                fragment = self._high.popleft() if self._high else self._normal.popleft()
+                self._state.notify_all()
+
+            if self._error is not None:
+                continue
+            try:
+                self._transport_send(fragment)
+                self.published_fragments += 1
+            except BaseException as exc:  # noqa: BLE001 - re-raised on close
+                with self._state:
+                    self._error = exc
+                    self._state.notify_all()
+
+    def close(self) -> None:
+        """Flush queued fragments and re-raise the first transmit failure."""
+        with self._state:
+            self._closed = True
+            self._state.notify_all()
+        self._thread.join()
+        if self._error is not None:
+            raise RuntimeError("MoQ sender failed.") from self._error
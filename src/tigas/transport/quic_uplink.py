@@ -1,22 +1,201 @@
-"""QUIC uplink placeholder.
+"""QUIC uplink endpoint.
 
-Receives or sends control datagrams depending on server or client role. The
-implementation is expected to use unreliable datagrams to minimize control-path
-latency and tolerate occasional loss.
+Receives or sends control datagrams depending on server or client role, using
+unreliable QUIC datagrams to minimize control-path latency and tolerate
+occasional loss. Payloads use the fixed-layout binary codec from
+`datagram_codec`, and received datagrams are buffered raw: the render loop
+drains them per tick with `receive_many`, which decodes only the newest pose
+under latest-wins coalescing so a 200 Hz uplink costs one decode per frame.
+
+aioquic is imported lazily (mirroring the gsplat backend) so the rest of the
+testbed works on hosts without it.
 """
 
 from __future__ import annotations
 
+import asyncio
+import ssl
+import struct
+from collections import deque
+from typing import Literal
+
 from tigas.shared.types import UplinkDatagram
+from tigas.transport.datagram_codec import DATAGRAM_WIRE_SIZE, UplinkDatagramCodec
+
+UplinkRole = Literal["server", "client"]
+
+_ALPN_PROTOCOL = "tigas-uplink"
+_SEQ_PREFIX = struct.Struct("<I")
+
+
+def _import_aioquic():
+    try:
+        from aioquic.asyncio import QuicConnectionProtocol, connect, serve
+        from aioquic.quic.configuration import QuicConfiguration
+        from aioquic.quic.events import DatagramFrameReceived
+    except ImportError as exc:  # pragma: no cover - depends on optional install
+        raise RuntimeError(
+            "aioquic is required for the QUIC uplink endpoint. "
+            "Install it with `pip install aioquic`."
+        ) from exc
+    return QuicConnectionProtocol, connect, serve, QuicConfiguration, DatagramFrameReceived
 
 
 class QuicUplinkEndpoint:
-    """Placeholder endpoint for datagram-based control traffic."""
+    """Asyncio endpoint for datagram-based control traffic.
+
+    A `server` role accepts one or more browser/client connections and
+    buffers their pose datagrams; a `client` role connects out and sends.
+    Either role can do both once connected.
+    """
+
+    def __init__(
+        self,
+        host: str = "0.0.0.0",
+        port: int = 4433,
+        role: UplinkRole = "server",
+        certificate_path: str | None = None,
+        private_key_path: str | None = None,
+        max_pending: int = 512,
+    ) -> None:
+        if role not in ("server", "client"):
+            raise ValueError(f"Unknown uplink role: {role}")
+        if role == "server" and not (certificate_path and private_key_path):
+            raise ValueError("Server role requires certificate_path and private_key_path.")
+
+        self.host = host
+        self.port = int(port)
+        self.role: UplinkRole = role
+        self.certificate_path = certificate_path
+        self.private_key_path = private_key_path
+
+        self._codec = UplinkDatagramCodec()
+        self._pending: deque[bytes] = deque(maxlen=max(1, max_pending))
+        self._arrival_event: asyncio.Event | None = None
+        self._protocol = None
+        self._server = None
+        self._client_context = None
+
+        self.received_datagrams = 0
+        self.dropped_datagrams = 0
+        self.coalesced_datagrams = 0
+
+    def _on_datagram(self, payload: bytes) -> None:
+        if len(payload) < DATAGRAM_WIRE_SIZE:
+            return
+        if len(self._pending) == self._pending.maxlen:
+            self.dropped_datagrams += 1
+        self._pending.append(payload)
+        self.received_datagrams += 1
+        if self._arrival_event is not None:
+            self._arrival_event.set()
+
+    def _build_protocol_class(self):
+        protocol_base, _, _, _, datagram_event_class = _import_aioquic()
+        endpoint = self
+
+        class _UplinkProtocol(protocol_base):  # type: ignore[misc, valid-type]
+            def quic_event_received(self, event) -> None:
+                if isinstance(event, datagram_event_class):
+                    endpoint._on_datagram(event.data)
+                    return
+                super().quic_event_received(event)
+
+        return _UplinkProtocol
+
+    async def start(self) -> None:
+        """Open the endpoint: bind as server or connect as client."""
+        if self._protocol is not None or self._server is not None:
+            raise RuntimeError("QUIC uplink endpoint is already started.")
+
+        _, connect, serve, configuration_class, _ = _import_aioquic()
+        self._arrival_event = asyncio.Event()
+        protocol_class = self._build_protocol_class()
+
+        configuration = configuration_class(
+            is_client=(self.role == "client"),
+            alpn_protocols=[_ALPN_PROTOCOL],
+            max_datagram_frame_size=65536,
+        )
+        if self.role == "server":
+            configuration.load_cert_chain(self.certificate_path, self.private_key_path)
+            self._server = await serve(
+                self.host,
+                self.port,
+                configuration=configuration,
+                create_protocol=protocol_class,
+            )
+        else:
+            # Testbed deployments run with self-signed certificates.
+            configuration.verify_mode = ssl.CERT_NONE
+            self._client_context = connect(
+                self.host,
+                self.port,
+                configuration=configuration,
+                create_protocol=protocol_class,
+            )
+            self._protocol = await self._client_context.__aenter__()
+
+    async def stop(self) -> None:
+        """Close the connection or stop accepting new ones."""
+        if self._client_context is not None:
+            await self._client_context.__aexit__(None, None, None)
+            self._client_context = None
+            self._protocol = None
+        if self._server is not None:
+            self._server.close()
+            self._server = None
+        self._pending.clear()
+        self._arrival_event = None
+
+    def _require_protocol(self):
+        if self._protocol is None:
+            raise RuntimeError(
+                "QUIC uplink endpoint has no active connection; call start() first "
+                "(server role sends only after a client connects)."
+            )
+        return self._protocol
 
     def send(self, datagram: UplinkDatagram) -> None:
-        """Send one control datagram."""
-        raise NotImplementedError("Implement QUIC datagram send path.")
+        """Send one control datagram; must run on the endpoint's event loop."""
+        protocol = self._require_protocol()
+        protocol._quic.send_datagram_frame(self._codec.encode(datagram))
+        protocol.transmit()
 
-    def receive(self) -> UplinkDatagram:
+    async def receive(self) -> UplinkDatagram:
         """Receive one control datagram and decode it to canonical type."""
-        raise NotImplementedError("Implement QUIC datagram receive path.")
+        if self._arrival_event is None:
+            raise RuntimeError("QUIC uplink endpoint is not started.")
+        while not self._pending:
+            self._arrival_event.clear()
+            await self._arrival_event.wait()
+        return self._codec.decode(self._pending.popleft())
+
+    def receive_many(self, latest_only: bool = True) -> list[UplinkDatagram]:
+        """Drain all pending datagrams without blocking.
+
+        With `latest_only` (the default) only the newest pose by sequence id
+        is decoded and returned, implementing latest-wins coalescing for the
+        render tick; otherwise every pending datagram is decoded in arrival
+        order.
+        """
+        if not self._pending:
+            return []
+
+        payloads = list(self._pending)
+        self._pending.clear()
+        if self._arrival_event is not None:
+            self._arrival_event.clear()
+
+        if not latest_only:
+            return [self._codec.decode(payload) for payload in payloads]
+
+        newest = payloads[0]
+        newest_seq = _SEQ_PREFIX.unpack_from(newest)[0]
+        for payload in payloads[1:]:
+            seq = _SEQ_PREFIX.unpack_from(payload)[0]
+            if seq >= newest_seq:
+                newest = payload
+                newest_seq = seq
+        self.coalesced_datagrams += len(payloads) - 1
+        return [self._codec.decode(newest)]
@@ -0,0 +1,87 @@
+"""Batch ABR decision API tests."""
+
+import numpy as np
+import pytest
+
+from tigas.intelligence.abr_client import (
+    AbrProfile,
+    BolaClientAbr,
+    RobustMpcClientAbr,
+    ThroughputClientAbr,
+)
+
+
+def _profile(algorithm: str) -> AbrProfile:
+    return AbrProfile.from_dict(
+        {
+            "name": f"test_{algorithm}",
+            "algorithm": algorithm,
+            "bitrates_kbps": [500, 1500, 3000, 6000],
+            "lods": ["sampled_10", "sampled_50", "full", "full"],
+            "min_bitrate_kbps": 300,
+            "max_bitrate_kbps": 8000,
+        }
+    )
+
+
+def test_throughput_batch_matches_scalar_path() -> None:
+    controller = ThroughputClientAbr(_profile("throughput"))
+    throughput = np.array([400.0, 1700.0, 3500.0, 9000.0, 650.0])
+    buffer_ms = np.full(5, 2000.0)
+
+    batch = controller.decide_batch(throughput, buffer_ms)
+
+    for index, value in enumerate(throughput):
+        scalar = controller.decide(
+            throughput_kbps=float(value), decode_latency_ms=0.0, buffer_level_ms=2000.0
+        )
+        assert int(batch.target_bitrate_kbps[index]) == scalar.target_bitrate_kbps
+        assert str(batch.requested_lods[index]) == scalar.requested_lod
+
+
+def test_bola_batch_matches_scalar_path() -> None:
+    controller = BolaClientAbr(_profile("bola"))
+    throughput = np.array([800.0, 2000.0, 5000.0, 1200.0])
+    buffer_ms = np.array([500.0, 1500.0, 4000.0, 250.0])
+
+    batch = controller.decide_batch(throughput, buffer_ms)
+
+    for index in range(len(throughput)):
+        scalar = controller.decide(
+            throughput_kbps=float(throughput[index]),
+            decode_latency_ms=0.0,
+            buffer_level_ms=float(buffer_ms[index]),
+        )
+        assert int(batch.target_bitrate_kbps[index]) == scalar.target_bitrate_kbps
+        assert str(batch.requested_lods[index]) == scalar.requested_lod
+
+
+def test_robustmpc_batch_tracks_throughput_and_keeps_state_untouched() -> None:
+    controller = RobustMpcClientAbr(_profile("robustmpc"))
+    low = np.full(50, 600.0)
+    high = np.full(50, 7000.0)
+    throughput = np.concatenate((low, high))
+    buffer_ms = np.full(100, 3000.0)
+
+    batch = controller.decide_batch(throughput, buffer_ms)
+
+    assert len(batch) == 100
+    # Sustained low throughput should select lower rungs than sustained high.
+    assert batch.target_bitrate_kbps[:40].mean() < batch.target_bitrate_kbps[60:].mean()
+    # Batch evaluation must not disturb the scalar controller's history.
+    assert len(controller._history) == 0
+    assert controller._last_choice == 500
+
+
+def test_batch_decisions_materialize_and_validate() -> None:
+    controller = ThroughputClientAbr(_profile("throughput"))
+    batch = controller.decide_batch(np.array([2000.0]), np.array([1000.0]))
+
+    decisions = batch.to_decisions()
+    assert len(decisions) == 1
+    assert decisions[0].target_bitrate_kbps == 1500
+
+    with pytest.raises(ValueError):
+        controller.decide_batch(np.array([1.0, 2.0]), np.array([1.0]))
+    with pytest.raises(ValueError):
+        controller.decide_batch(np.array([]), np.array([]))
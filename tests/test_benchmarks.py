@@ -0,0 +1,66 @@
+"""Benchmark harness and synthetic-asset tests."""
+
+import pytest
+
+from tigas.benchmarks.cases import (
+    write_standard_3dgs_ply,
+    write_supersplat_compressed_ply,
+)
+from tigas.benchmarks.harness import compare_baselines, time_case
+from tigas.renderer.supersplat_loader import (
+    load_standard_3dgs_ply,
+    load_supersplat_compressed_ply,
+)
+
+
+def test_time_case_runs_warmup_and_repeats() -> None:
+    calls = []
+
+    stats = time_case(lambda: calls.append(1), repeats=3, warmup=2)
+
+    assert len(calls) == 5  # warmup iterations are untimed but still executed
+    assert stats["repeats"] == 3.0
+    for key in ("mean_ms", "median_ms", "min_ms", "max_ms", "p95_ms", "stdev_ms"):
+        assert stats[key] >= 0.0
+
+
+def test_time_case_rejects_zero_repeats() -> None:
+    with pytest.raises(ValueError):
+        time_case(lambda: None, repeats=0)
+
+
+def test_compare_baselines_flags_regression_and_missing_cases() -> None:
+    baseline = {"render": {"median_ms": 10.0}, "removed": {"median_ms": 1.0}}
+    current = {"render": {"median_ms": 13.0}, "added": {"median_ms": 2.0}}
+
+    records = {record["case"]: record for record in compare_baselines(current, baseline, 20.0)}
+
+    assert records["render"]["regressed"] is True
+    assert records["render"]["delta_pct"] == pytest.approx(30.0)
+    assert records["removed"]["status"] == "missing_in_current"
+    assert records["added"]["status"] == "missing_in_baseline"
+    assert not records["removed"]["regressed"]
+    assert not records["added"]["regressed"]
+
+
+def test_compare_baselines_passes_within_threshold() -> None:
+    baseline = {"render": {"median_ms": 10.0}}
+    current = {"render": {"median_ms": 11.0}}
+
+    records = compare_baselines(current, baseline, 20.0)
+
+    assert len(records) == 1
+    assert records[0]["regressed"] is False
+
+
+def test_synthetic_assets_round_trip_through_loaders(tmp_path) -> None:
+    standard_path = write_standard_3dgs_ply(tmp_path / "standard.ply", point_count=64)
+    compressed_path = write_supersplat_compressed_ply(tmp_path / "compressed.ply", point_count=64)
+
+    standard = load_standard_3dgs_ply(str(standard_path))
+    compressed = load_supersplat_compressed_ply(str(compressed_path))
+
+    assert standard.point_count == 64
+    assert standard.encoding == "standard_3dgs"
+    assert compressed.point_count == 64
+    assert compressed.encoding == "supersplat_compressed"
@@ -0,0 +1,87 @@
+"""CPU raster engine equivalence tests."""
+
+import struct
+
+import numpy as np
+import pytest
+
+from tigas.renderer.backend_cpu import CpuFallbackBackend
+from tigas.shared.types import RenderRequest
+
+
+def _write_mini_standard_ply(ply_path) -> None:
+    header = "\n".join(
+        [
+            "ply",
+            "format binary_little_endian 1.0",
+            "element vertex 3",
+            "property float x",
+            "property float y",
+            "property float z",
+            "property float f_dc_0",
+            "property float f_dc_1",
+            "property float f_dc_2",
+            "property float opacity",
+            "property float scale_0",
+            "property float scale_1",
+            "property float scale_2",
+            "end_header",
+            "",
+        ]
+    ).encode("ascii")
+
+    vertices = b"".join(
+        struct.pack("<10f", x, y, z, 0.5, 0.5, 0.5, 2.0, -3.0, -3.0, -3.0)
+        for x, y, z in [(0.0, 0.0, 0.0), (0.4, 0.1, -0.2), (-0.3, -0.2, 0.3)]
+    )
+    ply_path.write_bytes(header + vertices)
+
+
+def _render_with_engine(ply_path, engine: str) -> np.ndarray:
+    backend = CpuFallbackBackend(
+        point_cloud_path=str(ply_path),
+        width=128,
+        height=96,
+        raster_engine=engine,
+    )
+    backend.initialize()
+    request = RenderRequest(
+        pose_matrix_4x4=[
+            1.0, 0.0, 0.0, 0.0,
+            0.0, 1.0, 0.0, 0.0,
+            0.0, 0.0, 1.0, 2.0,
+            0.0, 0.0, 0.0, 1.0,
+        ],
+        lod_id="full",
+        time_offset_ms=0.0,
+    )
+    frame = backend.render(request)
+    backend.shutdown()
+    return np.frombuffer(frame.data, dtype=np.uint8).reshape((96, 128, 3))
+
+
+def test_tiled_engine_matches_scatter(tmp_path) -> None:
+    ply_path = tmp_path / "mini_standard.ply"
+    _write_mini_standard_ply(ply_path)
+
+    scatter_frame = _render_with_engine(ply_path, "scatter")
+    tiled_frame = _render_with_engine(ply_path, "tiled")
+
+    assert scatter_frame.shape == tiled_frame.shape
+    np.testing.assert_array_equal(scatter_frame, tiled_frame)
+
+
+def test_invalid_engine_is_rejected() -> None:
+    with pytest.raises(ValueError):
+        CpuFallbackBackend(raster_engine="vectorized")
+
+
+def test_fused_engine_renders_with_or_without_numba(tmp_path) -> None:
+    ply_path = tmp_path / "mini_standard.ply"
+    _write_mini_standard_ply(ply_path)
+
+    scatter_frame = _render_with_engine(ply_path, "scatter")
+    fused_frame = _render_with_engine(ply_path, "fused")
+
+    assert fused_frame.shape == scatter_frame.shape
+    np.testing.assert_array_equal(fused_frame, scatter_frame)
@@ -0,0 +1,60 @@
+"""Binary uplink datagram codec tests."""
+
+import pytest
+
+from tigas.transport.datagram_codec import DATAGRAM_WIRE_SIZE, UplinkDatagramCodec
+from tigas.shared.types import UplinkDatagram
+
+
+def _sample_datagram() -> UplinkDatagram:
+    return UplinkDatagram(
+        seq_id=42,
+        timestamp_ms=1234.5,
+        camera_matrix_4x4=[float(i) * 0.25 for i in range(16)],
+        requested_lod="sampled_50",
+        target_bitrate_kbps=3500,
+    )
+
+
+def test_round_trip_preserves_fields() -> None:
+    codec = UplinkDatagramCodec()
+    original = _sample_datagram()
+
+    decoded = codec.decode(codec.encode(original))
+
+    assert decoded.seq_id == original.seq_id
+    assert decoded.timestamp_ms == original.timestamp_ms
+    assert decoded.requested_lod == original.requested_lod
+    assert decoded.target_bitrate_kbps == original.target_bitrate_kbps
+    assert decoded.camera_matrix_4x4 == pytest.approx(original.camera_matrix_4x4)
+
+
+def test_encode_into_reuses_one_buffer() -> None:
+    codec = UplinkDatagramCodec()
+    first = codec.encode_into(_sample_datagram())
+    assert len(first) == DATAGRAM_WIRE_SIZE
+
+    second = codec.encode_into(_sample_datagram())
+    assert first.obj is second.obj
+
+    decoded = codec.decode(second)
+    assert decoded.seq_id == 42
+
+
+def test_decode_rejects_short_payload() -> None:
+    codec = UplinkDatagramCodec()
+    with pytest.raises(ValueError):
+        codec.decode(b"\x00" * (DATAGRAM_WIRE_SIZE - 1))
+
+
+def test_encode_rejects_unknown_lod() -> None:
+    codec = UplinkDatagramCodec()
+    datagram = _sample_datagram()
+    datagram.requested_lod = "ultra"  # type: ignore[assignment]
+    with pytest.raises(ValueError):
+        codec.encode(datagram)
+
+
+def test_wire_size_matches_layout() -> None:
+    # 4 (seq) + 8 (timestamp) + 64 (matrix) + 1 (lod) + 4 (bitrate)
+    assert DATAGRAM_WIRE_SIZE == 81
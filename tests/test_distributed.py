@@ -0,0 +1,155 @@
+"""Distributed sweep coordinator, work queue, and worker protocol tests."""
+
+import pytest
+
+from tigas.orchestration.distributed import (
+    SweepCoordinator,
+    SweepWorker,
+    WorkQueue,
+    expand_config_matrix,
+    required_capabilities,
+)
+from tigas.shared.types import ExperimentConfig
+
+
+def _base_matrix(**overrides) -> dict:
+    matrix = {
+        "trace_path": "",
+        "codec": "libx264",
+        "predictor": "noop",
+        "network_profile": "wifi",
+        "default_lod": "full",
+        "asset_path": "assets/mini.ply",
+        "num_frames": 4,
+    }
+    matrix.update(overrides)
+    return matrix
+
+
+def _configs(count: int, **overrides) -> list[ExperimentConfig]:
+    return expand_config_matrix(_base_matrix(width=[96 + 16 * i for i in range(count)], **overrides))
+
+
+def test_expand_config_matrix_crosses_list_fields() -> None:
+    configs = expand_config_matrix(
+        _base_matrix(width=[96, 128], cpu_raster_engine=["scatter", "fused"])
+    )
+
+    assert len(configs) == 4
+    assert {(c.width, c.cpu_raster_engine) for c in configs} == {
+        (96, "scatter"),
+        (96, "fused"),
+        (128, "scatter"),
+        (128, "fused"),
+    }
+    assert all(c.codec == "libx264" for c in configs)
+
+
+def test_expand_config_matrix_rejects_unknown_fields() -> None:
+    with pytest.raises(ValueError, match="not_a_field"):
+        expand_config_matrix(_base_matrix(not_a_field=[1, 2]))
+
+
+def test_required_capabilities_tags_cuda_configs() -> None:
+    cpu_config = expand_config_matrix(_base_matrix())[0]
+    cuda_config = expand_config_matrix(
+        _base_matrix(renderer_backend="gsplat_cuda", codec="h264_nvenc")
+    )[0]
+
+    assert required_capabilities(cpu_config) == {"cpu"}
+    assert required_capabilities(cuda_config) == {"cpu", "cuda", "nvenc"}
+
+
+def test_work_queue_claims_respect_capabilities() -> None:
+    cpu_config = expand_config_matrix(_base_matrix())[0]
+    cuda_config = expand_config_matrix(_base_matrix(renderer_backend="gsplat_cuda"))[0]
+    queue = WorkQueue([cuda_config, cpu_config])
+
+    cpu_job = queue.claim({"cpu"})
+    assert cpu_job is not None
+    assert cpu_job.config_payload["renderer_backend"] == "cpu"
+    assert queue.claim({"cpu"}) is None  # remaining job needs cuda
+
+    cuda_job = queue.claim({"cpu", "cuda"})
+    assert cuda_job is not None
+    assert cuda_job.config_payload["renderer_backend"] == "gsplat_cuda"
+
+
+def test_work_queue_redispatches_expired_leases() -> None:
+    queue = WorkQueue(_configs(1), lease_timeout_s=0.0)
+
+    first = queue.claim({"cpu"})
+    second = queue.claim({"cpu"})  # lease already expired, same job again
+
+    assert first is not None and second is not None
+    assert second.job_id == first.job_id
+    assert second.attempts == 2
+
+
+def test_work_queue_retries_failures_up_to_max_attempts() -> None:
+    queue = WorkQueue(_configs(1), max_attempts=2)
+
+    job = queue.claim({"cpu"})
+    queue.fail(job.job_id, "OSError: boom")
+    retried = queue.claim({"cpu"})
+    assert retried is not None and retried.job_id == job.job_id
+
+    queue.fail(job.job_id, "OSError: boom again")
+    assert queue.claim({"cpu"}) is None
+    assert queue.all_done()
+    assert queue.failed_jobs() == [{"job_id": 0, "attempts": 2, "error": "OSError: boom again"}]
+
+
+def test_work_queue_ignores_duplicate_results_from_stragglers() -> None:
+    queue = WorkQueue(_configs(1), lease_timeout_s=0.0)
+    queue.claim({"cpu"})
+    queue.claim({"cpu"})  # re-dispatched straggler
+
+    queue.complete(0, {"status": "ok", "winner": True})
+    queue.complete(0, {"status": "ok", "winner": False})
+
+    assert queue.summaries[0]["winner"] is True
+    assert queue.all_done()
+
+
+def test_coordinator_worker_round_trip(monkeypatch, tmp_path) -> None:
+    coordinator = SweepCoordinator(_configs(3), host="127.0.0.1", port=0, lease_timeout_s=30.0)
+    coordinator.start()
+    host, port = coordinator.address
+
+    executed: list[int] = []
+
+    def fake_execute(self, config_payload):
+        executed.append(config_payload["width"])
+        if config_payload["width"] == 112 and executed.count(112) == 1:
+            raise OSError("transient render failure")
+        return {"status": "ok", "width": config_payload["width"]}
+
+    monkeypatch.setattr(SweepWorker, "_execute", fake_execute)
+
+    worker = SweepWorker(
+        host=host,
+        port=port,
+        output_root=str(tmp_path),
+        capabilities={"cpu"},
+        poll_interval_s=0.01,
+    )
+    try:
+        worker.run()
+        report = coordinator.run_until_complete(results_path=str(tmp_path / "results.jsonl"))
+    finally:
+        coordinator.shutdown()
+
+    assert worker.jobs_completed == 3
+    assert worker.jobs_failed == 1
+    assert report["stats"] == {"total": 3, "pending": 0, "leased": 0, "done": 3, "failed": 0}
+    assert report["failed"] == []
+    assert sorted(summary["width"] for summary in report["summaries"]) == [96, 112, 128]
+    assert (tmp_path / "results.jsonl").read_text().count("\n") == 3
+
+
+def test_work_queue_validation() -> None:
+    with pytest.raises(ValueError):
+        WorkQueue([])
+    with pytest.raises(ValueError):
+        WorkQueue(_configs(1), max_attempts=0)
@@ -0,0 +1,48 @@
+"""EbpfHookManager contract tests.
+
+Probe attachment needs BCC plus kernel capabilities, so these tests cover
+the dependency guard, lifecycle errors, and event normalization only.
+"""
+
+import pytest
+
+from tigas.instrumentation.ebpf_hooks import EbpfHookManager
+
+
+def test_unattached_manager_raises_on_use() -> None:
+    manager = EbpfHookManager()
+
+    with pytest.raises(RuntimeError):
+        manager.poll()
+    with pytest.raises(RuntimeError):
+        manager.read_events()
+    with pytest.raises(RuntimeError):
+        manager.start_drain()
+
+
+def test_invalid_udp_port_rejected() -> None:
+    with pytest.raises(ValueError):
+        EbpfHookManager(udp_port=0)
+    with pytest.raises(ValueError):
+        EbpfHookManager(udp_port=70000)
+
+
+def test_normalize_event_maps_directions() -> None:
+    egress = EbpfHookManager._normalize_event(123, 7, 81, 0)
+    ingress = EbpfHookManager._normalize_event(456, 8, 81, 1)
+    unknown = EbpfHookManager._normalize_event(789, 9, 81, 5)
+
+    assert egress == {
+        "timestamp_ns": 123,
+        "seq_id": 7,
+        "length": 81,
+        "event_type": "packet_egress",
+    }
+    assert ingress["event_type"] == "packet_ingress"
+    assert unknown["event_type"] == "packet_unknown"
+
+
+def test_detach_without_attach_is_idempotent() -> None:
+    manager = EbpfHookManager()
+    manager.detach()
+    manager.detach()
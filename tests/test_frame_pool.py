@@ -0,0 +1,39 @@
+"""Frame pool reuse tests."""
+
+import numpy as np
+
+from tigas.shared.frame_pool import FramePool
+
+
+def test_acquire_release_reuses_buffer() -> None:
+    pool = FramePool(width=8, height=4, capacity=2)
+
+    buffer = pool.acquire()
+    assert buffer.shape == (4, 8, 3)
+    assert buffer.dtype == np.uint8
+
+    view = memoryview(buffer.reshape(-1))
+    assert len(view) == pool.frame_nbytes
+
+    pool.release(view)
+    reused = pool.acquire()
+    assert reused.__array_interface__["data"][0] == buffer.__array_interface__["data"][0]
+
+
+def test_release_ignores_foreign_payloads() -> None:
+    pool = FramePool(width=8, height=4, capacity=2)
+    pool.release(b"immutable")
+    pool.release(memoryview(bytearray(5)))
+
+    fresh = pool.acquire()
+    assert fresh.nbytes == pool.frame_nbytes
+
+
+def test_capacity_bounds_free_list() -> None:
+    pool = FramePool(width=2, height=2, capacity=1)
+    first = pool.acquire()
+    second = pool.acquire()
+    pool.release(memoryview(first.reshape(-1)))
+    pool.release(memoryview(second.reshape(-1)))
+
+    assert len(pool._free) == 1
@@ -0,0 +1,83 @@
+"""LOD pyramid tier tests for the CPU backend."""
+
+import struct
+
+import numpy as np
+
+from tigas.renderer.backend_cpu import CpuFallbackBackend
+from tigas.shared.types import RenderRequest
+
+
+def _write_many_point_ply(ply_path, count: int = 40) -> None:
+    header = "\n".join(
+        [
+            "ply",
+            "format binary_little_endian 1.0",
+            f"element vertex {count}",
+            "property float x",
+            "property float y",
+            "property float z",
+            "property float f_dc_0",
+            "property float f_dc_1",
+            "property float f_dc_2",
+            "property float opacity",
+            "property float scale_0",
+            "property float scale_1",
+            "property float scale_2",
+            "end_header",
+            "",
+        ]
+    ).encode("ascii")
+    vertices = b"".join(
+        struct.pack(
+            "<10f",
+            0.1 * (idx % 7),
+            0.1 * (idx % 5),
+            0.05 * idx,
+            0.5,
+            0.5,
+            0.5,
+            0.1 * (idx % 10),
+            -3.0,
+            -3.0,
+            -3.0,
+        )
+        for idx in range(count)
+    )
+    ply_path.write_bytes(header + vertices)
+
+
+def test_lod_tiers_are_contiguous_prefixes(tmp_path) -> None:
+    ply_path = tmp_path / "many_points.ply"
+    _write_many_point_ply(ply_path, count=40)
+
+    backend = CpuFallbackBackend(point_cloud_path=str(ply_path), width=64, height=48)
+    backend.initialize()
+
+    assert backend._lod_point_count("full") == 40
+    assert backend._lod_point_count("sampled_50") == 20
+    assert backend._lod_point_count("sampled_25") == 10
+    assert backend._lod_point_count("sampled_10") == 4
+    assert backend._lod_point_count("quant_8bit") == 40
+
+    # Points are importance-ordered, so each tier is a prefix of the next.
+    opacity = backend._opacity
+    scale = backend._scale_xyz
+    importance = opacity * np.mean(scale, axis=1)
+    assert np.all(np.diff(importance) <= 1e-6)
+
+    for lod_id in ("full", "sampled_50", "sampled_25", "sampled_10"):
+        request = RenderRequest(
+            pose_matrix_4x4=[
+                1.0, 0.0, 0.0, 0.0,
+                0.0, 1.0, 0.0, 0.0,
+                0.0, 0.0, 1.0, 3.0,
+                0.0, 0.0, 0.0, 1.0,
+            ],
+            lod_id=lod_id,
+            time_offset_ms=0.0,
+        )
+        frame = backend.render(request)
+        assert frame.width == 64 and frame.height == 48
+
+    backend.shutdown()
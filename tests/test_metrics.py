@@ -0,0 +1,45 @@
+"""Quality metric engine tests."""
+
+import numpy as np
+import pytest
+
+from tigas.evaluation.metrics import psnr, ssim_proxy, ssim_windowed
+
+
+def _gradient_frame(height: int = 32, width: int = 48) -> np.ndarray:
+    ramp = np.linspace(0, 255, width, dtype=np.uint8)
+    return np.broadcast_to(ramp[None, :, None], (height, width, 3)).copy()
+
+
+def test_windowed_ssim_identical_frames_is_one() -> None:
+    frame = _gradient_frame()
+    assert ssim_windowed(frame, frame) == pytest.approx(1.0, abs=1e-6)
+
+
+def test_windowed_ssim_penalizes_local_artifact() -> None:
+    reference = _gradient_frame()
+    damaged = reference.copy()
+    damaged[8:16, 8:16, :] = 255
+
+    windowed = ssim_windowed(reference, damaged)
+    global_proxy = ssim_proxy(reference, damaged)
+
+    assert windowed < 1.0
+    # The local artifact barely moves global statistics but must show up
+    # in the windowed score.
+    assert windowed < global_proxy
+
+
+def test_windowed_ssim_rejects_shape_mismatch() -> None:
+    with pytest.raises(ValueError):
+        ssim_windowed(_gradient_frame(32, 48), _gradient_frame(16, 48))
+
+
+def test_psnr_identical_and_degraded() -> None:
+    frame = _gradient_frame()
+    assert psnr(frame, frame) == 100.0
+
+    noisy = frame.copy()
+    noisy[:, :, 0] = np.clip(noisy[:, :, 0].astype(np.int16) + 30, 0, 255).astype(np.uint8)
+    value = psnr(frame, noisy)
+    assert 0.0 < value < 100.0
@@ -0,0 +1,61 @@
+"""Metrics ring buffer adapter tests."""
+
+import json
+import time
+
+from tigas.instrumentation.metrics_adapter import MetricsBufferAdapter
+from tigas.shared.types import MetricEvent
+
+
+def _event(seq_id: int) -> MetricEvent:
+    return MetricEvent(
+        component="renderer",
+        event_type="render_frame",
+        timestamp_ns=MetricsBufferAdapter.now_ns(),
+        seq_id=seq_id,
+        duration_us=1250.0,
+        tags={"lod": "full"},
+    )
+
+
+def test_write_and_drain_round_trip(tmp_path) -> None:
+    adapter = MetricsBufferAdapter(capacity=16)
+    for seq_id in range(5):
+        adapter.write_event(_event(seq_id))
+
+    output_path = tmp_path / "metrics.parquet"
+    count = adapter.drain_to_parquet(str(output_path))
+
+    assert count == 5
+    assert adapter.dropped_events == 0
+    written = list(tmp_path.iterdir())
+    assert len(written) == 1
+
+    if written[0].suffix == ".jsonl":
+        rows = [json.loads(line) for line in written[0].read_text().splitlines()]
+        assert [row["seq_id"] for row in rows] == list(range(5))
+        assert rows[0]["component"] == "renderer"
+        assert rows[0]["tags"] == "lod=full"
+
+
+def test_full_ring_drops_instead_of_blocking() -> None:
+    adapter = MetricsBufferAdapter(capacity=8)
+    for seq_id in range(12):
+        adapter.write_event(_event(seq_id))
+
+    assert adapter.dropped_events == 4
+    rows = adapter._drain_available()
+    assert [row["seq_id"] for row in rows] == list(range(8))
+
+
+def test_background_drain_keeps_ring_from_filling(tmp_path) -> None:
+    adapter = MetricsBufferAdapter(capacity=8)
+    adapter.start_drain(flush_interval_s=0.01)
+
+    for seq_id in range(64):
+        adapter.write_event(_event(seq_id))
+        time.sleep(0.002)
+
+    count = adapter.drain_to_parquet(str(tmp_path / "metrics.parquet"))
+    assert count + adapter.dropped_events == 64
+    assert count > 8
@@ -0,0 +1,95 @@
+"""MoQ publisher scheduling tests."""
+
+import threading
+import time
+
+import pytest
+
+from tigas.shared.types import CmafFragment
+from tigas.transport.moq_publisher import MoqObjectPublisher
+
+
+def _fragment(fragment_id: int, timestamp_ms: float, priority: str = "normal", track_id: int = 1) -> CmafFragment:
+    return CmafFragment(
+        fragment_id=fragment_id,
+        track_id=track_id,
+        payload=b"\x00" * 8,
+        priority=priority,
+        timestamp_ms=timestamp_ms,
+    )
+
+
+def test_keyframe_preempts_and_drops_stale_normals() -> None:
+    gate = threading.Event()
+    sent: list[int] = []
+    first_taken = threading.Event()
+
+    def slow_send(fragment: CmafFragment) -> None:
+        if not sent:
+            first_taken.set()
+            gate.wait(timeout=5.0)
+        sent.append(fragment.fragment_id)
+
+    publisher = MoqObjectPublisher(transport_send=slow_send, max_queue_depth=8)
+    publisher.publish(_fragment(1, timestamp_ms=0.0))
+    assert first_taken.wait(timeout=5.0)
+
+    publisher.publish(_fragment(2, timestamp_ms=10.0))
+    publisher.publish(_fragment(3, timestamp_ms=20.0, priority="high"))
+    publisher.publish(_fragment(4, timestamp_ms=30.0))
+
+    gate.set()
+    publisher.close()
+
+    # Fragment 2 predates the keyframe and was dropped; the keyframe jumped
+    # ahead of the later normal fragment.
+    assert sent == [1, 3, 4]
+    assert publisher.dropped_stale_fragments == 1
+    assert publisher.published_fragments == 3
+
+
+def test_full_queue_back_pressures_publisher() -> None:
+    gate = threading.Event()
+    first_taken = threading.Event()
+
+    def blocking_send(fragment: CmafFragment) -> None:
+        first_taken.set()
+        gate.wait(timeout=5.0)
+
+    publisher = MoqObjectPublisher(transport_send=blocking_send, max_queue_depth=2)
+    publisher.publish(_fragment(1, timestamp_ms=0.0))
+    assert first_taken.wait(timeout=5.0)
+    publisher.publish(_fragment(2, timestamp_ms=10.0))
+    publisher.publish(_fragment(3, timestamp_ms=20.0))
+
+    blocked = threading.Event()
+
+    def overflow() -> None:
+        publisher.publish(_fragment(4, timestamp_ms=30.0))
+        blocked.set()
+
+    thread = threading.Thread(target=overflow, daemon=True)
+    thread.start()
+    time.sleep(0.05)
+    assert not blocked.is_set()  # publish is waiting on queue room
+
+    gate.set()
+    thread.join(timeout=5.0)
+    assert blocked.is_set()
+    publisher.close()
+
+
+def test_transmit_failure_surfaces_on_close() -> None:
+    def failing_send(fragment: CmafFragment) -> None:
+        raise OSError("link down")
+
+    publisher = MoqObjectPublisher(transport_send=failing_send, max_queue_depth=4)
+    publisher.publish(_fragment(1, timestamp_ms=0.0))
+
+    with pytest.raises(RuntimeError):
+        publisher.close()
+
+
+def test_rejects_invalid_queue_depth() -> None:
+    with pytest.raises(ValueError):
+        MoqObjectPublisher(transport_send=lambda fragment: None, max_queue_depth=0)
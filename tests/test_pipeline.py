@@ -0,0 +1,145 @@
+"""TigasPipeline stage wiring tests."""
+
+import struct
+
+import pytest
+
+from tigas.media.coder_interface import EncoderBackend
+from tigas.orchestration.pipeline import TigasPipeline
+from tigas.orchestration.registry import build_default_registry
+from tigas.shared.config import EncoderConfig, RenderConfig, RuntimeConfig
+from tigas.shared.types import EncodingPolicy, RawFrame, UplinkDatagram
+
+
+def _write_mini_standard_ply(ply_path) -> None:
+    header = "\n".join(
+        [
+            "ply",
+            "format binary_little_endian 1.0",
+            "element vertex 3",
+            "property float x",
+            "property float y",
+            "property float z",
+            "property float f_dc_0",
+            "property float f_dc_1",
+            "property float f_dc_2",
+            "property float opacity",
+            "property float scale_0",
+            "property float scale_1",
+            "property float scale_2",
+            "end_header",
+            "",
+        ]
+    ).encode("ascii")
+
+    vertices = b"".join(
+        struct.pack("<10f", x, y, z, 0.5, 0.5, 0.5, 2.0, -3.0, -3.0, -3.0)
+        for x, y, z in [(0.0, 0.0, 0.0), (0.4, 0.1, -0.2), (-0.3, -0.2, 0.3)]
+    )
+    ply_path.write_bytes(header + vertices)
+
+
+class _StubEncoder(EncoderBackend):
+    """Deterministic encoder so pipeline tests do not require ffmpeg."""
+
+    def __init__(self, fps: int = 30) -> None:
+        self.fps = fps
+        self.encoded_frames = 0
+
+    @property
+    def encoder_name(self) -> str:
+        return "stub"
+
+    def encode(self, frame: RawFrame, policy: EncodingPolicy) -> bytes:
+        self.encoded_frames += 1
+        return b"frame-%d" % frame.frame_id
+
+
+def _pipeline(tmp_path, **pipeline_kwargs) -> TigasPipeline:
+    ply_path = tmp_path / "mini.ply"
+    _write_mini_standard_ply(ply_path)
+
+    config = RuntimeConfig(
+        render=RenderConfig(
+            backend="cpu",
+            point_cloud_path=str(ply_path),
+            width=96,
+            height=64,
+        ),
+        encoder=EncoderConfig(codec="libx264", gop_size=4),
+    )
+    registry = build_default_registry()
+    registry.encoders["libx264"] = _StubEncoder
+    return TigasPipeline(config=config, registry=registry, **pipeline_kwargs)
+
+
+def _datagram(seq_id: int) -> UplinkDatagram:
+    matrix = [
+        1.0, 0.0, 0.0, 0.0,
+        0.0, 1.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 2.0,
+        0.0, 0.0, 0.0, 1.0,
+    ]
+    return UplinkDatagram(
+        seq_id=seq_id,
+        timestamp_ms=seq_id * 10.0,
+        camera_matrix_4x4=matrix,
+        requested_lod="full",
+        target_bitrate_kbps=4000,
+    )
+
+
+def test_step_runs_all_stages(tmp_path) -> None:
+    pipeline = _pipeline(tmp_path)
+
+    fragment = pipeline.step(_datagram(0))
+
+    assert fragment is not None
+    assert fragment.payload == b"frame-0"
+    assert fragment.priority == "high"  # first frame opens a GOP
+    gauges = pipeline.gauges()
+    for stage in ("predictor", "renderer", "encoder", "packager", "transport"):
+        assert gauges[stage]["processed"] == 1
+    pipeline.stop()
+
+
+def test_pose_buffer_coalesces_latest_wins(tmp_path) -> None:
+    pipeline = _pipeline(tmp_path)
+    for seq_id in (1, 2, 3):
+        pipeline.submit_pose(_datagram(seq_id))
+
+    fragment = pipeline.step()
+
+    assert fragment is not None
+    assert pipeline.coalesced_poses == 2
+    assert pipeline.step() is None  # buffer fully drained
+    pipeline.stop()
+
+
+def test_gop_marks_periodic_keyframes(tmp_path) -> None:
+    pipeline = _pipeline(tmp_path)
+    priorities = [pipeline.step(_datagram(i)).priority for i in range(6)]
+
+    # gop_size=4: frames 0 and 4 open GOPs.
+    assert priorities == ["high", "normal", "normal", "normal", "high", "normal"]
+    pipeline.stop()
+
+
+def test_fragment_sink_receives_output(tmp_path) -> None:
+    received = []
+    pipeline = _pipeline(tmp_path, fragment_sink=received.append)
+
+    pipeline.step(_datagram(0))
+
+    assert len(received) == 1
+    pipeline.stop()
+
+
+def test_unknown_component_name_raises(tmp_path) -> None:
+    ply_path = tmp_path / "mini.ply"
+    _write_mini_standard_ply(ply_path)
+    config = RuntimeConfig(
+        render=RenderConfig(backend="vulkan", point_cloud_path=str(ply_path))
+    )
+    with pytest.raises(ValueError):
+        TigasPipeline(config=config)
@@ -1,6 +1,6 @@
 """Predictor scaffold tests."""
 
-import pytest
+import numpy as np
 
 from tigas.intelligence.predictor_kalman import KalmanPosePredictor
 from tigas.intelligence.predictor_noop import NoOpPosePredictor
@@ -17,6 +17,18 @@ def _sample_datagram() -> UplinkDatagram:
     )
 
 
+def _pose_datagram(seq_id: int, timestamp_ms: float, position) -> UplinkDatagram:
+    matrix = np.eye(4)
+    matrix[:3, 3] = position
+    return UplinkDatagram(
+        seq_id=seq_id,
+        timestamp_ms=timestamp_ms,
+        camera_matrix_4x4=matrix.reshape(16).tolist(),
+        requested_lod="full",
+        target_bitrate_kbps=3000,
+    )
+
+
 def test_noop_predictor_passthrough() -> None:
     predictor = NoOpPosePredictor()
     prediction = predictor.predict(_sample_datagram(), rtt_ms=25.0)
@@ -26,7 +38,52 @@ def test_noop_predictor_passthrough() -> None:
     assert prediction.confidence == 1.0
 
 
-def test_kalman_predictor_is_placeholder() -> None:
+def test_kalman_predictor_tracks_linear_motion() -> None:
     predictor = KalmanPosePredictor()
-    with pytest.raises(NotImplementedError):
-        predictor.predict(_sample_datagram(), rtt_ms=25.0)
+    # Camera moving at 1 unit/s along x, sampled at 100 Hz.
+    prediction = None
+    for step in range(50):
+        prediction = predictor.predict(
+            _pose_datagram(step, step * 10.0, (step * 0.01, 0.0, 0.0)),
+            rtt_ms=100.0,
+        )
+
+    assert prediction is not None
+    predicted_x = prediction.predicted_matrix_4x4[3]
+    current_x = 49 * 0.01
+    # 100 ms horizon at 1 unit/s should put the prediction ~0.1 ahead.
+    assert current_x + 0.05 < predicted_x < current_x + 0.15
+    assert 0.0 < prediction.confidence <= 1.0
+
+
+def test_kalman_predictor_stationary_pose_stays_put() -> None:
+    predictor = KalmanPosePredictor()
+    prediction = None
+    for step in range(20):
+        prediction = predictor.predict(
+            _pose_datagram(step, step * 10.0, (0.5, -0.2, 1.0)),
+            rtt_ms=50.0,
+        )
+
+    assert prediction is not None
+    matrix = np.asarray(prediction.predicted_matrix_4x4).reshape((4, 4))
+    np.testing.assert_allclose(matrix[:3, 3], (0.5, -0.2, 1.0), atol=1e-3)
+    np.testing.assert_allclose(matrix[:3, :3], np.eye(3), atol=1e-6)
+
+
+def test_kalman_batch_prediction_matches_trace_shape() -> None:
+    predictor = KalmanPosePredictor()
+    count = 64
+    timestamps_ms = np.arange(count) * 10.0
+    matrices = np.tile(np.eye(4).reshape(16), (count, 1))
+    matrices[:, 3] = np.arange(count) * 0.01  # 1 unit/s along x
+
+    predicted, confidences = predictor.predict_batch(timestamps_ms, matrices, rtt_ms=100.0)
+
+    assert predicted.shape == (count, 16)
+    assert confidences.shape == (count,)
+    assert np.all((confidences > 0.0) & (confidences <= 1.0))
+    # Later samples have a settled velocity estimate: ~0.1 units ahead.
+    np.testing.assert_allclose(
+        predicted[-1, 3], matrices[-1, 3] + 0.1, atol=0.02
+    )
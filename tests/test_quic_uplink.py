@@ -0,0 +1,85 @@
+"""QUIC uplink endpoint buffering tests (transport-free)."""
+
+import pytest
+
+from tigas.shared.types import UplinkDatagram
+from tigas.transport.datagram_codec import UplinkDatagramCodec
+from tigas.transport.quic_uplink import QuicUplinkEndpoint
+
+
+def _endpoint(**overrides) -> QuicUplinkEndpoint:
+    defaults = dict(role="client", host="127.0.0.1", port=4433)
+    defaults.update(overrides)
+    return QuicUplinkEndpoint(**defaults)
+
+
+def _payload(seq_id: int) -> bytes:
+    return UplinkDatagramCodec().encode(
+        UplinkDatagram(
+            seq_id=seq_id,
+            timestamp_ms=seq_id * 5.0,
+            camera_matrix_4x4=[0.0] * 16,
+            requested_lod="full",
+            target_bitrate_kbps=4000,
+        )
+    )
+
+
+def test_receive_many_coalesces_to_newest() -> None:
+    endpoint = _endpoint()
+    for seq_id in (3, 1, 7, 5):
+        endpoint._on_datagram(_payload(seq_id))
+
+    decoded = endpoint.receive_many()
+
+    assert len(decoded) == 1
+    assert decoded[0].seq_id == 7
+    assert endpoint.coalesced_datagrams == 3
+    assert endpoint.receive_many() == []
+
+
+def test_receive_many_preserves_order_without_coalescing() -> None:
+    endpoint = _endpoint()
+    for seq_id in (1, 2, 3):
+        endpoint._on_datagram(_payload(seq_id))
+
+    decoded = endpoint.receive_many(latest_only=False)
+
+    assert [d.seq_id for d in decoded] == [1, 2, 3]
+
+
+def test_bounded_buffer_counts_drops() -> None:
+    endpoint = _endpoint(max_pending=4)
+    for seq_id in range(10):
+        endpoint._on_datagram(_payload(seq_id))
+
+    assert endpoint.dropped_datagrams == 6
+    decoded = endpoint.receive_many(latest_only=False)
+    assert [d.seq_id for d in decoded] == [6, 7, 8, 9]
+
+
+def test_runt_payloads_are_ignored() -> None:
+    endpoint = _endpoint()
+    endpoint._on_datagram(b"\x01\x02")
+
+    assert endpoint.received_datagrams == 0
+    assert endpoint.receive_many() == []
+
+
+def test_server_role_requires_certificates() -> None:
+    with pytest.raises(ValueError):
+        QuicUplinkEndpoint(role="server")
+
+
+def test_send_without_connection_raises() -> None:
+    endpoint = _endpoint()
+    with pytest.raises(RuntimeError):
+        endpoint.send(
+            UplinkDatagram(
+                seq_id=0,
+                timestamp_ms=0.0,
+                camera_matrix_4x4=[0.0] * 16,
+                requested_lod="full",
+                target_bitrate_kbps=4000,
+            )
+        )
@@ -0,0 +1,88 @@
+"""Real-time paced runner tests."""
+
+import struct
+
+import pytest
+
+from tigas.orchestration.ablation_runner import HeadlessAblationRunner
+from tigas.shared.types import ExperimentConfig
+
+
+def _write_mini_standard_ply(ply_path) -> None:
+    header = "\n".join(
+        [
+            "ply",
+            "format binary_little_endian 1.0",
+            "element vertex 3",
+            "property float x",
+            "property float y",
+            "property float z",
+            "property float f_dc_0",
+            "property float f_dc_1",
+            "property float f_dc_2",
+            "property float opacity",
+            "property float scale_0",
+            "property float scale_1",
+            "property float scale_2",
+            "end_header",
+            "",
+        ]
+    ).encode("ascii")
+
+    vertices = b"".join(
+        struct.pack("<10f", x, y, z, 0.5, 0.5, 0.5, 2.0, -3.0, -3.0, -3.0)
+        for x, y, z in [(0.0, 0.0, 0.0), (0.4, 0.1, -0.2), (-0.3, -0.2, 0.3)]
+    )
+    ply_path.write_bytes(header + vertices)
+
+
+def _config(ply_path, **overrides) -> ExperimentConfig:
+    defaults = dict(
+        trace_path="",
+        codec="libx264",
+        predictor="noop",
+        network_profile="wifi",
+        default_lod="full",
+        asset_path=str(ply_path),
+        num_frames=8,
+        fps=120,
+        width=96,
+        height=64,
+    )
+    defaults.update(overrides)
+    return ExperimentConfig(**defaults)
+
+
+def test_realtime_pacing_reports_stall_statistics(tmp_path) -> None:
+    ply_path = tmp_path / "mini.ply"
+    _write_mini_standard_ply(ply_path)
+
+    summary = HeadlessAblationRunner().run_one(_config(ply_path, realtime_pacing=True))
+
+    pacing = summary["pacing"]
+    assert pacing["mode"] == "realtime"
+    assert pacing["dropped_frames"] + summary["frames_rendered"] == 8
+    assert pacing["stall_time_ms_total"] >= 0.0
+    assert pacing["max_lateness_ms"] >= 0.0
+
+
+def test_unpaced_mode_reports_no_drops(tmp_path) -> None:
+    ply_path = tmp_path / "mini.ply"
+    _write_mini_standard_ply(ply_path)
+
+    summary = HeadlessAblationRunner().run_one(_config(ply_path))
+
+    pacing = summary["pacing"]
+    assert pacing["mode"] == "unpaced"
+    assert pacing["dropped_frames"] == 0
+    assert pacing["late_frames"] == 0
+
+
+def test_realtime_pacing_rejects_pipelined_mode(tmp_path) -> None:
+    ply_path = tmp_path / "mini.ply"
+    _write_mini_standard_ply(ply_path)
+
+    with pytest.raises(ValueError):
+        HeadlessAblationRunner().run_one(
+            _config(ply_path, realtime_pacing=True, pipeline_mode="pipelined")
+        )
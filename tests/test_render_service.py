@@ -0,0 +1,133 @@
+"""Render service and renderer cache tests."""
+
+import io
+import json
+import struct
+
+import pytest
+
+from tigas.orchestration.render_service import RendererCache, RenderService
+
+
+def _write_mini_standard_ply(ply_path) -> None:
+    header = "\n".join(
+        [
+            "ply",
+            "format binary_little_endian 1.0",
+            "element vertex 3",
+            "property float x",
+            "property float y",
+            "property float z",
+            "property float f_dc_0",
+            "property float f_dc_1",
+            "property float f_dc_2",
+            "property float opacity",
+            "property float scale_0",
+            "property float scale_1",
+            "property float scale_2",
+            "end_header",
+            "",
+        ]
+    ).encode("ascii")
+
+    vertices = b"".join(
+        struct.pack("<10f", x, y, z, 0.5, 0.5, 0.5, 2.0, -3.0, -3.0, -3.0)
+        for x, y, z in [(0.0, 0.0, 0.0), (0.4, 0.1, -0.2), (-0.3, -0.2, 0.3)]
+    )
+    ply_path.write_bytes(header + vertices)
+
+
+def _request_payload(ply_path, **overrides) -> dict:
+    payload = {
+        "trace_path": "",
+        "codec": "libx264",
+        "predictor": "noop",
+        "network_profile": "wifi",
+        "default_lod": "full",
+        "asset_path": str(ply_path),
+        "num_frames": 4,
+        "width": 96,
+        "height": 64,
+    }
+    payload.update(overrides)
+    return payload
+
+
+def test_cache_reuses_renderer_for_identical_scene(tmp_path) -> None:
+    ply_path = tmp_path / "mini.ply"
+    _write_mini_standard_ply(ply_path)
+    service = RenderService(cache_capacity=2)
+
+    first = service.run_request(_request_payload(ply_path))
+    second = service.run_request(_request_payload(ply_path))
+    service.close()
+
+    assert first["status"] == "ok"
+    assert second["status"] == "ok"
+    assert first["renderer_cache"] == {"hits": 0, "misses": 1, "evictions": 0}
+    assert second["renderer_cache"] == {"hits": 1, "misses": 1, "evictions": 0}
+
+
+def test_cache_key_splits_on_resolution(tmp_path) -> None:
+    ply_path = tmp_path / "mini.ply"
+    _write_mini_standard_ply(ply_path)
+    service = RenderService(cache_capacity=2)
+
+    service.run_request(_request_payload(ply_path))
+    second = service.run_request(_request_payload(ply_path, width=64, height=48))
+    service.close()
+
+    assert second["renderer_cache"]["misses"] == 2
+
+
+def test_cache_evicts_least_recently_used(tmp_path) -> None:
+    ply_path = tmp_path / "mini.ply"
+    _write_mini_standard_ply(ply_path)
+    service = RenderService(cache_capacity=1)
+
+    service.run_request(_request_payload(ply_path))
+    summary = service.run_request(_request_payload(ply_path, width=64, height=48))
+    service.close()
+
+    assert summary["renderer_cache"]["evictions"] == 1
+
+
+def test_invalid_request_returns_error_response(tmp_path) -> None:
+    service = RenderService()
+
+    unknown_field = service.run_request({"not_a_field": 1})
+    missing_scene = service.run_request(_request_payload(tmp_path / "missing.ply"))
+    service.close()
+
+    assert unknown_field["status"] == "error"
+    assert "not_a_field" in unknown_field["error"]
+    assert missing_scene["status"] == "error"
+    assert "FileNotFoundError" in missing_scene["error"]
+
+
+def test_serve_stdio_json_lines_round_trip(tmp_path) -> None:
+    ply_path = tmp_path / "mini.ply"
+    _write_mini_standard_ply(ply_path)
+    request_lines = "\n".join(
+        [
+            json.dumps(_request_payload(ply_path)),
+            "not json",
+            json.dumps({"command": "shutdown"}),
+            json.dumps(_request_payload(ply_path)),  # after shutdown: ignored
+        ]
+    )
+    output = io.StringIO()
+
+    RenderService().serve_stdio(io.StringIO(request_lines), output)
+
+    responses = [json.loads(line) for line in output.getvalue().splitlines()]
+    assert len(responses) == 3
+    assert responses[0]["status"] == "ok"
+    assert responses[0]["frames_rendered"] == 4
+    assert responses[1]["status"] == "error"
+    assert responses[2] == {"status": "ok", "command": "shutdown"}
+
+
+def test_cache_capacity_validation() -> None:
+    with pytest.raises(ValueError):
+        RendererCache(capacity=0)
@@ -0,0 +1,93 @@
+"""Incremental run-cache key and index tests."""
+
+import json
+
+from tigas.evaluation.run_cache import RunCache
+from tigas.shared.types import ExperimentConfig
+
+
+def _config(asset_path, **overrides) -> ExperimentConfig:
+    payload = {
+        "trace_path": "",
+        "codec": "libx264",
+        "predictor": "noop",
+        "network_profile": "wifi",
+        "default_lod": "full",
+        "asset_path": str(asset_path),
+        "num_frames": 4,
+        "width": 96,
+        "height": 64,
+    }
+    payload.update(overrides)
+    return ExperimentConfig(**payload)
+
+
+def _cached_summary(tmp_path, name="summary.json") -> dict:
+    summary_path = tmp_path / name
+    summary_path.write_text("{}")
+    return {"status": "ok", "summary_path": str(summary_path), "output_dir": str(tmp_path)}
+
+
+def test_key_changes_with_config_fields_and_asset_contents(tmp_path) -> None:
+    asset = tmp_path / "scene.ply"
+    asset.write_bytes(b"ply-v1")
+    cache = RunCache(str(tmp_path))
+
+    base_key = cache.key_for(_config(asset))
+    assert cache.key_for(_config(asset)) == base_key
+    assert cache.key_for(_config(asset, quant_bits=6)) != base_key
+    assert cache.key_for(_config(asset), quality_metric="windowed") != base_key
+    assert cache.key_for(_config(asset), with_reference=True) != base_key
+
+    asset.write_bytes(b"ply-v2")
+    assert cache.key_for(_config(asset)) != base_key
+
+
+def test_trace_name_vs_file_digest(tmp_path) -> None:
+    asset = tmp_path / "scene.ply"
+    asset.write_bytes(b"ply")
+    trace = tmp_path / "trace.csv"
+    trace.write_text("0,1000\n")
+    cache = RunCache(str(tmp_path))
+
+    file_key = cache.key_for(_config(asset, network_trace_path=str(trace)))
+    name_key = cache.key_for(_config(asset, network_trace_path="lte_steps"))
+    assert file_key != name_key
+
+    trace.write_text("0,2000\n")
+    assert cache.key_for(_config(asset, network_trace_path=str(trace))) != file_key
+    assert cache.key_for(_config(asset, network_trace_path="lte_steps")) == name_key
+
+
+def test_store_persists_across_instances_and_force_discards(tmp_path) -> None:
+    summary = _cached_summary(tmp_path)
+    cache = RunCache(str(tmp_path))
+    cache.store("key-a", summary)
+
+    reopened = RunCache(str(tmp_path))
+    assert reopened.lookup("key-a") == summary
+    assert reopened.stats() == {"hits": 1, "misses": 0, "entries": 1}
+
+    forced = RunCache(str(tmp_path), force=True)
+    assert forced.lookup("key-a") is None
+    assert forced.stats()["misses"] == 1
+
+
+def test_lookup_misses_when_artifacts_were_cleaned(tmp_path) -> None:
+    summary = _cached_summary(tmp_path)
+    cache = RunCache(str(tmp_path))
+    cache.store("key-a", summary)
+
+    (tmp_path / "summary.json").unlink()
+    assert cache.lookup("key-a") is None
+    assert cache.stats()["misses"] == 1
+
+
+def test_index_file_layout(tmp_path) -> None:
+    cache = RunCache(str(tmp_path))
+    cache.store("key-a", _cached_summary(tmp_path))
+
+    index = json.loads((tmp_path / "run_cache_index.json").read_text())
+    assert index["schema_version"] == 1
+    assert "key-a" in index["entries"]
+    assert "created_at_utc" in index["entries"]["key-a"]
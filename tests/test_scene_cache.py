@@ -0,0 +1,60 @@
+"""Decoded-scene sidecar cache tests."""
+
+import struct
+
+import numpy as np
+
+from tigas.renderer.scene_cache import load_decoded_cloud_cached
+
+
+def _write_mini_standard_ply(ply_path) -> None:
+    header = "\n".join(
+        [
+            "ply",
+            "format binary_little_endian 1.0",
+            "element vertex 2",
+            "property float x",
+            "property float y",
+            "property float z",
+            "property float f_dc_0",
+            "property float f_dc_1",
+            "property float f_dc_2",
+            "property float opacity",
+            "property float scale_0",
+            "property float scale_1",
+            "property float scale_2",
+            "end_header",
+            "",
+        ]
+    ).encode("ascii")
+    vertices = b"".join(
+        struct.pack("<10f", x, y, z, 0.5, 0.5, 0.5, 1.0, -3.0, -3.0, -3.0)
+        for x, y, z in [(0.0, 0.0, 0.0), (1.0, 2.0, 3.0)]
+    )
+    ply_path.write_bytes(header + vertices)
+
+
+def test_cache_roundtrip_matches_decode(tmp_path) -> None:
+    ply_path = tmp_path / "mini_standard.ply"
+    _write_mini_standard_ply(ply_path)
+
+    decoded = load_decoded_cloud_cached(str(ply_path))
+    sidecar = tmp_path / "mini_standard.ply.tigas_cache"
+    assert sidecar.exists()
+
+    cached = load_decoded_cloud_cached(str(ply_path))
+    assert isinstance(cached.xyz, np.memmap)
+    assert cached.point_count == decoded.point_count
+    assert cached.encoding == decoded.encoding
+    np.testing.assert_array_equal(np.asarray(cached.xyz), decoded.xyz)
+    np.testing.assert_array_equal(np.asarray(cached.rgb), decoded.rgb)
+    np.testing.assert_allclose(np.asarray(cached.opacity), decoded.opacity)
+
+
+def test_cache_disabled_decodes_directly(tmp_path) -> None:
+    ply_path = tmp_path / "mini_standard.ply"
+    _write_mini_standard_ply(ply_path)
+
+    decoded = load_decoded_cloud_cached(str(ply_path), use_cache=False)
+    assert decoded.point_count == 2
+    assert not (tmp_path / "mini_standard.ply.tigas_cache").exists()
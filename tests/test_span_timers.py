@@ -0,0 +1,103 @@
+"""Span timer recorder and renderer instrumentation tests."""
+
+import struct
+
+from tigas.instrumentation.metrics_adapter import MetricsBufferAdapter
+from tigas.instrumentation.span_timers import NULL_RECORDER, SpanRecorder
+from tigas.renderer.backend_cpu import CpuFallbackBackend
+from tigas.shared.types import RenderRequest
+
+
+def _write_mini_standard_ply(ply_path) -> None:
+    header = "\n".join(
+        [
+            "ply",
+            "format binary_little_endian 1.0",
+            "element vertex 3",
+            "property float x",
+            "property float y",
+            "property float z",
+            "property float f_dc_0",
+            "property float f_dc_1",
+            "property float f_dc_2",
+            "property float opacity",
+            "property float scale_0",
+            "property float scale_1",
+            "property float scale_2",
+            "end_header",
+            "",
+        ]
+    ).encode("ascii")
+
+    vertices = b"".join(
+        struct.pack("<10f", x, y, z, 0.5, 0.5, 0.5, 2.0, -3.0, -3.0, -3.0)
+        for x, y, z in [(0.0, 0.0, 0.0), (0.4, 0.1, -0.2), (-0.3, -0.2, 0.3)]
+    )
+    ply_path.write_bytes(header + vertices)
+
+
+def _identity_request() -> RenderRequest:
+    matrix = [
+        1.0, 0.0, 0.0, 0.0,
+        0.0, 1.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 2.0,
+        0.0, 0.0, 0.0, 1.0,
+    ]
+    return RenderRequest(pose_matrix_4x4=matrix, lod_id="full", time_offset_ms=0.0)
+
+
+def test_recorder_aggregates_mean_and_p95() -> None:
+    recorder = SpanRecorder()
+    for _ in range(4):
+        start = recorder.begin()
+        recorder.end("stage_a", start)
+
+    summary = recorder.summarize()
+    assert set(summary) == {"stage_a"}
+    assert summary["stage_a"]["count"] == 4.0
+    assert summary["stage_a"]["mean_ms"] >= 0.0
+    assert summary["stage_a"]["p95_ms"] <= summary["stage_a"]["max_ms"]
+
+
+def test_disabled_recorder_records_nothing() -> None:
+    start = NULL_RECORDER.begin()
+    NULL_RECORDER.end("stage_a", start)
+
+    assert start == 0
+    assert NULL_RECORDER.summarize() == {}
+
+
+def test_recorder_emits_metric_events_when_adapter_attached() -> None:
+    metrics = MetricsBufferAdapter(capacity=64)
+    recorder = SpanRecorder(component="renderer", metrics=metrics)
+
+    recorder.end("blur", recorder.begin())
+
+    rows = metrics._drain_available()
+    assert len(rows) == 1
+    assert rows[0]["component"] == "renderer"
+    assert rows[0]["event_type"] == "blur"
+    assert rows[0]["duration_us"] >= 0.0
+
+
+def test_cpu_render_records_sub_stage_spans(tmp_path) -> None:
+    ply_path = tmp_path / "mini.ply"
+    _write_mini_standard_ply(ply_path)
+    recorder = SpanRecorder()
+    backend = CpuFallbackBackend(
+        point_cloud_path=str(ply_path),
+        width=96,
+        height=64,
+        use_scene_cache=False,
+        span_recorder=recorder,
+    )
+    backend.initialize()
+
+    frame = backend.render(_identity_request())
+    backend.recycle(frame)
+    backend.shutdown()
+
+    summary = recorder.summarize()
+    for stage in ("cull_select", "project", "accumulate", "blur", "composite"):
+        assert stage in summary
+        assert summary[stage]["count"] == 1.0
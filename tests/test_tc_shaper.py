@@ -0,0 +1,57 @@
+"""AsyncTcShaper schedule compilation tests.
+
+Command execution requires tc and elevated capabilities, so these tests
+cover the precompiled schedule and rendered command lines only.
+"""
+
+import pytest
+
+from tigas.instrumentation.tc_profiles import AsyncTcShaper
+
+
+def test_schedule_collapses_consecutive_duplicate_rates() -> None:
+    shaper = AsyncTcShaper(
+        interface_name="lo",
+        timestamps_ms=[0.0, 33.3, 66.6, 100.0, 133.3],
+        rates_kbps=[4000, 4000, 2000, 2000, 4000],
+    )
+
+    assert shaper.steps_total == 3
+    assert shaper._schedule[0] == (0.0, 4000)
+    assert shaper._schedule[1][1] == 2000
+    assert shaper._schedule[2][1] == 4000
+    # Offsets are relative to the first trace timestamp, in seconds.
+    assert shaper._schedule[1][0] == pytest.approx(0.0666, abs=1e-4)
+
+
+def test_schedule_clamps_non_positive_rates() -> None:
+    shaper = AsyncTcShaper(
+        interface_name="lo",
+        timestamps_ms=[0.0, 33.3],
+        rates_kbps=[0, -5],
+    )
+
+    assert shaper.steps_total == 1
+    assert shaper._schedule[0][1] == 1
+
+
+def test_rejects_empty_or_mismatched_schedules() -> None:
+    with pytest.raises(ValueError):
+        AsyncTcShaper(interface_name="lo", timestamps_ms=[], rates_kbps=[])
+    with pytest.raises(ValueError):
+        AsyncTcShaper(interface_name="lo", timestamps_ms=[0.0], rates_kbps=[100, 200])
+    with pytest.raises(ValueError):
+        AsyncTcShaper(interface_name="", timestamps_ms=[0.0], rates_kbps=[100])
+
+
+def test_command_line_renders_tbf_change() -> None:
+    shaper = AsyncTcShaper(
+        interface_name="eth0",
+        timestamps_ms=[0.0],
+        rates_kbps=[2500],
+        burst_kbit=32,
+        latency_ms=40,
+    )
+
+    line = shaper._command_line("change", 2500)
+    assert line == "qdisc change dev eth0 root tbf rate 2500kbit burst 32kbit latency 40ms"
@@ -0,0 +1,58 @@
+"""Structure-of-arrays trace block tests."""
+
+import json
+
+import numpy as np
+
+from tigas.input_control.headless_replayer import HeadlessTraceReplayer
+
+
+def test_block_and_sample_paths_agree_on_position_trace(tmp_path) -> None:
+    rows = [
+        {"x": float(np.cos(t)), "y": 0.2, "z": float(np.sin(t)), "tMs": t * 100.0}
+        for t in range(24)
+    ]
+    trace_path = tmp_path / "trace.json"
+    trace_path.write_text(json.dumps(rows))
+
+    replayer = HeadlessTraceReplayer()
+    block = replayer.load_trace_block(str(trace_path))
+    samples = replayer.load_trace(str(trace_path))
+
+    assert len(block) == len(samples) == 24
+    for idx, sample in enumerate(samples):
+        assert sample.timestamp_ms == block.timestamps_ms[idx]
+        np.testing.assert_allclose(sample.camera_matrix_4x4, block.camera_matrices[idx])
+
+
+def test_batched_look_at_matches_scalar_path() -> None:
+    replayer = HeadlessTraceReplayer()
+    eyes = [(1.0, 0.3, -0.5), (0.0, 2.0, 0.0), (-1.2, 0.0, 0.8)]
+    target = (0.1, 0.0, 0.2)
+
+    batched = replayer._look_at_batch(np.asarray(eyes), np.asarray(target))
+    for idx, eye in enumerate(eyes):
+        scalar = replayer._look_at_camera_to_world(eye=eye, target=target)
+        np.testing.assert_allclose(batched[idx], scalar, atol=1e-12)
+
+
+def test_apply_network_trace_block_cycles_bandwidth() -> None:
+    replayer = HeadlessTraceReplayer()
+    block = replayer.generate_orbit_block(center=(0.0, 0.0, 0.0), radius=1.0, num_frames=7)
+
+    shaped = replayer.apply_network_trace_block(block, bandwidth_kbps=[1000, 2000, 3000])
+
+    assert shaped.target_bitrates_kbps.tolist() == [1000, 2000, 3000, 1000, 2000, 3000, 1000]
+    # Pose arrays are shared, not copied.
+    assert shaped.camera_matrices is block.camera_matrices
+
+
+def test_truncate_then_build_datagrams() -> None:
+    replayer = HeadlessTraceReplayer()
+    block = replayer.generate_orbit_block(center=(0.0, 0.0, 0.0), radius=1.0, num_frames=120)
+
+    datagrams = replayer.build_datagrams_from_block(block.truncate(10))
+
+    assert len(datagrams) == 10
+    assert datagrams[-1].seq_id == 9
+    assert len(datagrams[0].camera_matrix_4x4) == 16
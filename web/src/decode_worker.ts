@@ -0,0 +1,122 @@
+/**
+ * Dedicated worker hosting the WebCodecs VideoDecoder.
+ *
+ * Decode stays off the main thread so page layout and presentation never
+ * stall it. The message protocol is transfer-only in both directions:
+ *
+ *   main -> worker  {type:"configure", codec, codedWidth?, codedHeight?}
+ *   main -> worker  {type:"fragment", fragmentId, timestampUs, isKeyframe,
+ *                    payload: ArrayBuffer (transferred)}
+ *   main -> worker  {type:"close"}
+ *   worker -> main  {type:"frame", frame: VideoFrame (transferred),
+ *                    fragmentId, decodeTimeMs, queueDepth}
+ *   worker -> main  {type:"error", message}
+ *   worker -> main  {type:"closed"}
+ */
+
+interface ConfigureMessage {
+  type: "configure";
+  codec: string;
+  codedWidth?: number;
+  codedHeight?: number;
+}
+
+interface FragmentMessage {
+  type: "fragment";
+  fragmentId: number;
+  timestampUs: number;
+  isKeyframe: boolean;
+  payload: ArrayBuffer;
+}
+
+interface CloseMessage {
+  type: "close";
+}
+
+type WorkerRequest = ConfigureMessage | FragmentMessage | CloseMessage;
+
+interface PendingDecode {
+  fragmentId: number;
+  submittedMs: number;
+}
+
+let decoder: VideoDecoder | null = null;
+// Keyed by chunk timestamp, which WebCodecs preserves onto the output frame.
+const pendingByTimestamp = new Map<number, PendingDecode>();
+
+function postError(message: string): void {
+  self.postMessage({ type: "error", message });
+}
+
+function handleDecodedFrame(frame: VideoFrame): void {
+  const pending = pendingByTimestamp.get(frame.timestamp);
+  pendingByTimestamp.delete(frame.timestamp);
+  self.postMessage(
+    {
+      type: "frame",
+      frame,
+      fragmentId: pending ? pending.fragmentId : -1,
+      decodeTimeMs: pending ? performance.now() - pending.submittedMs : -1,
+      queueDepth: decoder ? decoder.decodeQueueSize : 0,
+    },
+    [frame as unknown as Transferable],
+  );
+}
+
+function configure(message: ConfigureMessage): void {
+  decoder = new VideoDecoder({
+    output: handleDecodedFrame,
+    error: (error: DOMException) => postError(`decoder: ${error.message}`),
+  });
+  decoder.configure({
+    codec: message.codec,
+    codedWidth: message.codedWidth,
+    codedHeight: message.codedHeight,
+    optimizeForLatency: true,
+  });
+}
+
+function decodeFragment(message: FragmentMessage): void {
+  if (decoder === null || decoder.state !== "configured") {
+    postError("fragment received before decoder was configured");
+    return;
+  }
+  pendingByTimestamp.set(message.timestampUs, {
+    fragmentId: message.fragmentId,
+    submittedMs: performance.now(),
+  });
+  decoder.decode(
+    new EncodedVideoChunk({
+      type: message.isKeyframe ? "key" : "delta",
+      timestamp: message.timestampUs,
+      data: message.payload,
+    }),
+  );
+}
+
+async function close(): Promise<void> {
+  if (decoder !== null) {
+    if (decoder.state === "configured") {
+      await decoder.flush().catch(() => undefined);
+    }
+    decoder.close();
+    decoder = null;
+  }
+  pendingByTimestamp.clear();
+  self.postMessage({ type: "closed" });
+}
+
+self.onmessage = (event: MessageEvent<WorkerRequest>) => {
+  const message = event.data;
+  switch (message.type) {
+    case "configure":
+      configure(message);
+      break;
+    case "fragment":
+      decodeFragment(message);
+      break;
+    case "close":
+      void close();
+      break;
+  }
+};
@@ -1,18 +1,122 @@
 /**
- * Decoder placeholder for CMAF fragment handling and WebCodecs decode.
+ * Worker-backed WebCodecs decode pipeline.
+ *
+ * The VideoDecoder lives in `decode_worker.ts`; this class owns the worker
+ * lifecycle and the transfer-only message protocol. Fragment payloads are
+ * transferred into the worker (the caller's view is detached afterwards)
+ * and decoded frames come back as transferable `VideoFrame`s, so no pixel
+ * or bitstream bytes are copied across the thread boundary.
  */
 
+export interface DecodeStats {
+  fragmentId: number;
+  presentationTimestampUs: number;
+  decodeTimeMs: number;
+  queueDepth: number;
+}
+
+export type DecodedFrameHandler = (frame: VideoFrame, stats: DecodeStats) => void;
+
 export class DecoderPipeline {
-  async initialize(): Promise<void> {
-    throw new Error("Implement decoder and demux initialization.");
+  /** Receives ownership of each decoded frame; the handler must close() it. */
+  onFrame: DecodedFrameHandler | null = null;
+  /** Per-frame decode timings for the metrics uplink. */
+  onDecodeStats: ((stats: DecodeStats) => void) | null = null;
+  onError: ((message: string) => void) | null = null;
+
+  private worker: Worker | null = null;
+  private resolveClosed: (() => void) | null = null;
+
+  async initialize(codec = "avc1.42E01E", codedWidth?: number, codedHeight?: number): Promise<void> {
+    if (this.worker !== null) {
+      throw new Error("DecoderPipeline is already initialized.");
+    }
+    this.worker = new Worker(new URL("./decode_worker.ts", import.meta.url), {
+      type: "module",
+      name: "tigas-decode",
+    });
+    this.worker.onmessage = (event: MessageEvent) => this.handleWorkerMessage(event.data);
+    this.worker.postMessage({ type: "configure", codec, codedWidth, codedHeight });
   }
 
-  async pushFragment(fragment: Uint8Array): Promise<void> {
-    void fragment;
-    throw new Error("Implement CMAF fragment ingestion and decode dispatch.");
+  /**
+   * Submit one encoded fragment for decode.
+   *
+   * The fragment's underlying ArrayBuffer is transferred to the worker;
+   * callers that still need the bytes must pass a copy.
+   */
+  async pushFragment(
+    fragment: Uint8Array,
+    fragmentId: number,
+    timestampUs: number,
+    isKeyframe: boolean,
+  ): Promise<void> {
+    if (this.worker === null) {
+      throw new Error("DecoderPipeline is not initialized.");
+    }
+    const payload =
+      fragment.byteOffset === 0 && fragment.byteLength === fragment.buffer.byteLength
+        ? fragment.buffer
+        : fragment.slice().buffer;
+    this.worker.postMessage(
+      { type: "fragment", fragmentId, timestampUs, isKeyframe, payload },
+      [payload],
+    );
   }
 
   async shutdown(): Promise<void> {
-    throw new Error("Implement decoder teardown and resource release.");
+    if (this.worker === null) {
+      return;
+    }
+    const worker = this.worker;
+    const closed = new Promise<void>((resolve) => {
+      this.resolveClosed = resolve;
+    });
+    worker.postMessage({ type: "close" });
+    // Terminate even if the worker never acknowledges (e.g. decoder wedged).
+    await Promise.race([closed, new Promise<void>((resolve) => setTimeout(resolve, 1000))]);
+    worker.terminate();
+    this.worker = null;
+    this.resolveClosed = null;
+  }
+
+  private handleWorkerMessage(message: {
+    type: string;
+    frame?: VideoFrame;
+    fragmentId?: number;
+    decodeTimeMs?: number;
+    queueDepth?: number;
+    message?: string;
+  }): void {
+    switch (message.type) {
+      case "frame": {
+        const frame = message.frame as VideoFrame;
+        const stats: DecodeStats = {
+          fragmentId: message.fragmentId ?? -1,
+          presentationTimestampUs: frame.timestamp,
+          decodeTimeMs: message.decodeTimeMs ?? -1,
+          queueDepth: message.queueDepth ?? 0,
+        };
+        if (this.onDecodeStats !== null) {
+          this.onDecodeStats(stats);
+        }
+        if (this.onFrame !== null) {
+          this.onFrame(frame, stats);
+        } else {
+          frame.close();
+        }
+        break;
+      }
+      case "error":
+        if (this.onError !== null) {
+          this.onError(message.message ?? "unknown decoder error");
+        }
+        break;
+      case "closed":
+        if (this.resolveClosed !== null) {
+          this.resolveClosed();
+        }
+        break;
+    }
   }
 }
@@ -2,9 +2,22 @@
  * MoQ client placeholder.
  *
  * This module will own WebTransport lifecycle and object stream handling.
+ * Fragment delivery is already contract-shaped: when the object stream
+ * reader lands it must invoke `onFragment` with the received payload so
+ * the decode pipeline wiring in `main.ts` keeps working unchanged.
  */
 
+export interface FragmentInfo {
+  fragmentId: number;
+  trackId: number;
+  timestampMs: number;
+  priority: "high" | "normal";
+}
+
 export class MoqClient {
+  /** Invoked for every received MoQ object; payload ownership transfers to the handler. */
+  onFragment: ((payload: Uint8Array, info: FragmentInfo) => void) | null = null;
+
   async connect(url: string): Promise<void> {
     void url;
     throw new Error("Implement WebTransport session setup and MoQ handshake.");
@@ -2,10 +2,23 @@
  * Uplink datagram contract used by browser runtime.
  *
  * This mirrors the server schema so interactive and headless sources share
- * identical control semantics.
+ * identical control semantics. The binary layout matches the fixed-size
+ * little-endian struct in `src/tigas/transport/datagram_codec.py`:
+ *
+ *   seq_id              uint32      @ 0
+ *   timestamp_ms        float64     @ 4
+ *   camera_matrix_4x4   16x float32 @ 12
+ *   requested_lod       uint8 enum  @ 76
+ *   target_bitrate_kbps uint32      @ 77
  */
 
-export type LodId = "full" | "sampled_50" | "quant_8bit" | "adaptive";
+export type LodId =
+  | "full"
+  | "sampled_50"
+  | "sampled_25"
+  | "sampled_10"
+  | "quant_8bit"
+  | "adaptive";
 
 export interface UplinkDatagram {
   seq_id: number;
@@ -15,6 +28,79 @@ export interface UplinkDatagram {
   target_bitrate_kbps: number;
 }
 
+export const DATAGRAM_WIRE_SIZE = 81;
+
+const LOD_TO_CODE: Record<LodId, number> = {
+  full: 0,
+  sampled_50: 1,
+  sampled_25: 2,
+  sampled_10: 3,
+  quant_8bit: 4,
+  adaptive: 5,
+};
+
+const CODE_TO_LOD: LodId[] = [
+  "full",
+  "sampled_50",
+  "sampled_25",
+  "sampled_10",
+  "quant_8bit",
+  "adaptive",
+];
+
+/**
+ * Binary datagram encoder writing into one reusable ArrayBuffer.
+ *
+ * The Uint8Array returned by `encode` aliases the internal buffer and is
+ * only valid until the next `encode` call; transports that need to retain
+ * the payload must copy it (QUIC datagram sends consume it immediately).
+ */
+export class UplinkDatagramEncoder {
+  private readonly buffer = new ArrayBuffer(DATAGRAM_WIRE_SIZE);
+  private readonly view = new DataView(this.buffer);
+  private readonly bytes = new Uint8Array(this.buffer);
+
+  encode(datagram: UplinkDatagram): Uint8Array {
+    const view = this.view;
+    view.setUint32(0, datagram.seq_id >>> 0, true);
+    view.setFloat64(4, datagram.timestamp_ms, true);
+    for (let i = 0; i < 16; i++) {
+      view.setFloat32(12 + i * 4, datagram.camera_matrix_4x4[i], true);
+    }
+    view.setUint8(76, LOD_TO_CODE[datagram.requested_lod]);
+    view.setUint32(77, Math.max(1, datagram.target_bitrate_kbps) >>> 0, true);
+    return this.bytes;
+  }
+}
+
+export function decodeDatagram(payload: Uint8Array): UplinkDatagram {
+  if (payload.byteLength < DATAGRAM_WIRE_SIZE) {
+    throw new Error(
+      `Uplink datagram payload too short: need ${DATAGRAM_WIRE_SIZE} bytes, got ${payload.byteLength}.`,
+    );
+  }
+  const view = new DataView(payload.buffer, payload.byteOffset, payload.byteLength);
+  const matrix = new Array<number>(16);
+  for (let i = 0; i < 16; i++) {
+    matrix[i] = view.getFloat32(12 + i * 4, true);
+  }
+  const lod = CODE_TO_LOD[view.getUint8(76)];
+  if (lod === undefined) {
+    throw new Error(`Unknown requested_lod code in payload: ${view.getUint8(76)}`);
+  }
+  return {
+    seq_id: view.getUint32(0, true),
+    timestamp_ms: view.getFloat64(4, true),
+    camera_matrix_4x4: matrix,
+    requested_lod: lod,
+    target_bitrate_kbps: view.getUint32(77, true),
+  };
+}
+
+/**
+ * Legacy JSON serialization, kept for tooling that inspects datagrams as
+ * text. The QUIC control path should use `UplinkDatagramEncoder`.
+ */
 export function serializeDatagram(datagram: UplinkDatagram): Uint8Array {
   const payload = JSON.stringify(datagram);
   return new TextEncoder().encode(payload);